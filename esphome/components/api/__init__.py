@@ -45,6 +45,8 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 CONF_ENCRYPTION = "encryption"
+CONF_BINARY_LOGS = "binary_logs"
+CONF_PROTO_TABLES = "proto_tables"
 
 
 def validate_encryption_key(value):
@@ -87,6 +89,8 @@ CONFIG_SCHEMA = cv.Schema(
                 cv.Required(CONF_KEY): validate_encryption_key,
             }
         ),
+        cv.Optional(CONF_BINARY_LOGS, default=False): cv.boolean,
+        cv.Optional(CONF_PROTO_TABLES, default=False): cv.boolean,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -125,6 +129,13 @@ async def to_code(config):
     else:
         cg.add_define("USE_API_PLAINTEXT")
 
+    if config[CONF_BINARY_LOGS]:
+        cg.add_define("USE_API_BINARY_LOGS")
+
+    if config[CONF_PROTO_TABLES]:
+        # Smaller, table-driven message codec, see script/api_protobuf/benchmark.py
+        cg.add_define("USE_API_PROTO_TABLES")
+
     cg.add_define("USE_API")
     cg.add_global(api_ns.using)
 
@@ -138,10 +138,13 @@ void APIConnection::loop() {
       state_subs_at_ = -1;
     } else {
       auto &it = subs[state_subs_at_];
-      SubscribeHomeAssistantStateResponse resp;
-      resp.entity_id = it.entity_id;
-      resp.attribute = it.attribute.value();
-      if (this->send_subscribe_home_assistant_state_response(resp)) {
+      // Encode straight from the subscription instead of copying its strings into a message
+      auto buffer = this->create_buffer();
+      // string entity_id = 1;
+      buffer.encode_string(1, it.entity_id);
+      // string attribute = 2;
+      buffer.encode_string(2, it.attribute.value());
+      if (this->send_buffer(buffer, 39)) {
         state_subs_at_++;
       }
     }
@@ -166,15 +169,18 @@ void APIConnection::on_disconnect_response(const DisconnectResponse &value) {
 }
 
 #ifdef USE_BINARY_SENSOR
-bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
-  if (!this->state_subscription_)
-    return false;
-
+BinarySensorStateResponse APIConnection::make_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor,
+                                                                  bool state) {
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !binary_sensor->has_state();
-  return this->send_binary_sensor_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_binary_sensor_state_response(make_binary_sensor_state(binary_sensor, state));
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
@@ -192,10 +198,7 @@ bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_
 #endif
 
 #ifdef USE_COVER
-bool APIConnection::send_cover_state(cover::Cover *cover) {
-  if (!this->state_subscription_)
-    return false;
-
+CoverStateResponse APIConnection::make_cover_state(cover::Cover *cover) {
   auto traits = cover->get_traits();
   CoverStateResponse resp{};
   resp.key = cover->get_object_id_hash();
@@ -205,7 +208,12 @@ bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (traits.get_supports_tilt())
     resp.tilt = cover->tilt;
   resp.current_operation = static_cast<enums::CoverOperation>(cover->current_operation);
-  return this->send_cover_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_cover_state(cover::Cover *cover) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_cover_state_response(make_cover_state(cover));
 }
 bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
@@ -253,10 +261,7 @@ void APIConnection::cover_command(const CoverCommandRequest &msg) {
 #endif
 
 #ifdef USE_FAN
-bool APIConnection::send_fan_state(fan::Fan *fan) {
-  if (!this->state_subscription_)
-    return false;
-
+FanStateResponse APIConnection::make_fan_state(fan::Fan *fan) {
   auto traits = fan->get_traits();
   FanStateResponse resp{};
   resp.key = fan->get_object_id_hash();
@@ -268,7 +273,12 @@ bool APIConnection::send_fan_state(fan::Fan *fan) {
   }
   if (traits.supports_direction())
     resp.direction = static_cast<enums::FanDirection>(fan->direction);
-  return this->send_fan_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_fan_state(fan::Fan *fan) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_fan_state_response(make_fan_state(fan));
 }
 bool APIConnection::send_fan_info(fan::Fan *fan) {
   auto traits = fan->get_traits();
@@ -307,10 +317,7 @@ void APIConnection::fan_command(const FanCommandRequest &msg) {
 #endif
 
 #ifdef USE_LIGHT
-bool APIConnection::send_light_state(light::LightState *light) {
-  if (!this->state_subscription_)
-    return false;
-
+LightStateResponse APIConnection::make_light_state(light::LightState *light) {
   auto traits = light->get_traits();
   auto values = light->remote_values;
   auto color_mode = values.get_color_mode();
@@ -330,7 +337,12 @@ bool APIConnection::send_light_state(light::LightState *light) {
   resp.warm_white = values.get_warm_white();
   if (light->supports_effects())
     resp.effect = light->get_effect_name();
-  return this->send_light_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_light_state(light::LightState *light) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_light_state_response(make_light_state(light));
 }
 bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
@@ -404,15 +416,17 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
 #endif
 
 #ifdef USE_SENSOR
-bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
-  if (!this->state_subscription_)
-    return false;
-
+SensorStateResponse APIConnection::make_sensor_state(sensor::Sensor *sensor, float state) {
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_sensor_state_response(make_sensor_state(sensor, state));
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -435,14 +449,16 @@ bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
 #endif
 
 #ifdef USE_SWITCH
-bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
-  if (!this->state_subscription_)
-    return false;
-
+SwitchStateResponse APIConnection::make_switch_state(switch_::Switch *a_switch, bool state) {
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
-  return this->send_switch_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_switch_state_response(make_switch_state(a_switch, state));
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
@@ -471,15 +487,17 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 #endif
 
 #ifdef USE_TEXT_SENSOR
-bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+TextSensorStateResponse APIConnection::make_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_text_sensor_state_response(make_text_sensor_state(text_sensor, std::move(state)));
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -497,10 +515,7 @@ bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor)
 #endif
 
 #ifdef USE_CLIMATE
-bool APIConnection::send_climate_state(climate::Climate *climate) {
-  if (!this->state_subscription_)
-    return false;
-
+ClimateStateResponse APIConnection::make_climate_state(climate::Climate *climate) {
   auto traits = climate->get_traits();
   ClimateStateResponse resp{};
   resp.key = climate->get_object_id_hash();
@@ -526,7 +541,12 @@ bool APIConnection::send_climate_state(climate::Climate *climate) {
     resp.custom_preset = climate->custom_preset.value();
   if (traits.get_supports_swing_modes())
     resp.swing_mode = static_cast<enums::ClimateSwingMode>(climate->swing_mode);
-  return this->send_climate_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_climate_state(climate::Climate *climate) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_climate_state_response(make_climate_state(climate));
 }
 bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
@@ -595,15 +615,17 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 #endif
 
 #ifdef USE_NUMBER
-bool APIConnection::send_number_state(number::Number *number, float state) {
-  if (!this->state_subscription_)
-    return false;
-
+NumberStateResponse APIConnection::make_number_state(number::Number *number, float state) {
   NumberStateResponse resp{};
   resp.key = number->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !number->has_state();
-  return this->send_number_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_number_state(number::Number *number, float state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_number_state_response(make_number_state(number, state));
 }
 bool APIConnection::send_number_info(number::Number *number) {
   ListEntitiesNumberResponse msg;
@@ -635,15 +657,17 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 #endif
 
 #ifdef USE_SELECT
-bool APIConnection::send_select_state(select::Select *select, std::string state) {
-  if (!this->state_subscription_)
-    return false;
-
+SelectStateResponse APIConnection::make_select_state(select::Select *select, std::string state) {
   SelectStateResponse resp{};
   resp.key = select->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !select->has_state();
-  return this->send_select_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_select_state(select::Select *select, std::string state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_select_state_response(make_select_state(select, std::move(state)));
 }
 bool APIConnection::send_select_info(select::Select *select) {
   ListEntitiesSelectResponse msg;
@@ -694,14 +718,16 @@ void APIConnection::button_command(const ButtonCommandRequest &msg) {
 #endif
 
 #ifdef USE_LOCK
-bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
-  if (!this->state_subscription_)
-    return false;
-
+LockStateResponse APIConnection::make_lock_state(lock::Lock *a_lock, lock::LockState state) {
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
   resp.state = static_cast<enums::LockState>(state);
-  return this->send_lock_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_lock_state_response(make_lock_state(a_lock, state));
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
   ListEntitiesLockResponse msg;
@@ -737,16 +763,18 @@ void APIConnection::lock_command(const LockCommandRequest &msg) {
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
-  if (!this->state_subscription_)
-    return false;
-
+MediaPlayerStateResponse APIConnection::make_media_player_state(media_player::MediaPlayer *media_player) {
   MediaPlayerStateResponse resp{};
   resp.key = media_player->get_object_id_hash();
   resp.state = static_cast<enums::MediaPlayerState>(media_player->state);
   resp.volume = media_player->volume;
   resp.muted = media_player->is_muted();
-  return this->send_media_player_state_response(resp);
+  return resp;
+}
+bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
+  if (!this->state_subscription_)
+    return false;
+  return this->send_media_player_state_response(make_media_player_state(media_player));
 }
 bool APIConnection::send_media_player_info(media_player::MediaPlayer *media_player) {
   ListEntitiesMediaPlayerResponse msg;
@@ -828,7 +856,7 @@ void APIConnection::on_get_time_response(const GetTimeResponse &value) {
 
 #ifdef USE_BLUETOOTH_PROXY
 bool APIConnection::send_bluetooth_le_advertisement(const BluetoothLEAdvertisementResponse &msg) {
-  if (!this->bluetooth_le_advertisement_subscription_)
+  if (!this->is_subscribed_to_bluetooth_le_advertisements(false))
     return false;
   if (this->client_api_version_major_ < 1 || this->client_api_version_minor_ < 7) {
     BluetoothLEAdvertisementResponse resp = msg;
@@ -844,6 +872,11 @@ bool APIConnection::send_bluetooth_le_advertisement(const BluetoothLEAdvertiseme
   }
   return this->send_bluetooth_le_advertisement_response(msg);
 }
+bool APIConnection::send_bluetooth_le_raw_advertisements(const BluetoothLERawAdvertisementsResponse &msg) {
+  if (!this->is_subscribed_to_bluetooth_le_advertisements(true))
+    return false;
+  return this->send_bluetooth_le_raw_advertisements_response(msg);
+}
 void APIConnection::bluetooth_device_request(const BluetoothDeviceRequest &msg) {
   bluetooth_proxy::global_bluetooth_proxy->bluetooth_device_request(msg);
 }
@@ -879,6 +912,14 @@ BluetoothConnectionsFreeResponse APIConnection::subscribe_bluetooth_connections_
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
+#ifdef USE_API_BINARY_LOGS
+  // Binary subscribers only get the text of the messages that send_binary_log_message() couldn't send
+  if (this->log_binary_) {
+    if (!this->log_text_fallback_)
+      return false;
+    this->log_text_fallback_ = false;
+  }
+#endif
 
   // Send raw so that we don't copy too much
   auto buffer = this->create_buffer();
@@ -890,6 +931,87 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
   return this->send_buffer(buffer, 29);
 }
 
+#ifdef USE_API_BINARY_LOGS
+bool APIConnection::get_log_string_id_(const char *value, bool is_static, uint32_t *id) {
+  if (this->log_strings_ == nullptr)
+    this->log_strings_.reset(new LogString[LOG_STRINGS_SIZE]());  // NOLINT
+
+  uint32_t key = is_static ? static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value) >> 2) : fnv1_hash(value);
+  LogString *slot = nullptr;
+  for (uint8_t i = 0; i < LOG_STRINGS_SIZE; i++) {
+    LogString &entry = this->log_strings_[(key + i) % LOG_STRINGS_SIZE];
+    if (entry.value == nullptr) {
+      slot = &entry;
+      break;
+    }
+    if (entry.value == value || (!is_static && strcmp(entry.value, value) == 0)) {
+      *id = entry.id;
+      return true;
+    }
+  }
+  if (slot == nullptr || this->log_strings_count_ >= MAX_LOG_STRINGS)
+    return false;
+
+  uint32_t new_id = this->log_strings_count_ + 1;
+  size_t len = strlen(value);
+  auto buffer = this->create_buffer();
+  // uint32 id = 1;
+  buffer.encode_uint32(1, new_id);
+  // string value = 2;
+  buffer.encode_string(2, value, len);
+  // SubscribeLogsStringResponse - 85
+  if (!this->send_buffer(buffer, 85))
+    return false;
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  if (!is_static) {
+    std::unique_ptr<char[]> copy(new char[len + 1]);  // NOLINT
+    memcpy(copy.get(), value, len + 1);
+    value = copy.get();
+    this->log_string_copies_.push_back(std::move(copy));
+  }
+#endif
+  slot->value = value;
+  slot->id = new_id;
+  this->log_strings_count_++;
+  *id = new_id;
+  return true;
+}
+bool APIConnection::send_binary_log_message(int level, const char *tag, int line, const char *format,
+                                            uint32_t timestamp, const std::vector<uint8_t> &args) {
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  // The logger passes a copy of the format string from flash
+  const bool format_is_static = false;
+#else
+  const bool format_is_static = true;
+#endif
+  this->log_text_fallback_ = false;
+  uint32_t tag_id, format_id;
+  if (!this->get_log_string_id_(tag, true, &tag_id) ||
+      !this->get_log_string_id_(format, format_is_static, &format_id)) {
+    // With the table full, the message is sent as text by send_log_message(), which the logger calls next
+    this->log_text_fallback_ = this->log_strings_count_ >= MAX_LOG_STRINGS;
+    return false;
+  }
+
+  // Send raw so that we don't copy too much
+  auto buffer = this->create_buffer();
+  // LogLevel level = 1;
+  buffer.encode_uint32(1, static_cast<uint32_t>(level));
+  // uint32 tag_id = 2;
+  buffer.encode_uint32(2, tag_id);
+  // uint32 format_id = 3;
+  buffer.encode_uint32(3, format_id);
+  // uint32 line = 4;
+  buffer.encode_uint32(4, static_cast<uint32_t>(line));
+  // uint32 timestamp = 5;
+  buffer.encode_uint32(5, timestamp);
+  // bytes args = 6;
+  buffer.encode_bytes(6, args.data(), args.size());
+  // SubscribeLogsBinaryResponse - 86
+  return this->send_buffer(buffer, 86);
+}
+#endif
+
 HelloResponse APIConnection::hello(const HelloRequest &msg) {
   this->client_info_ = msg.client_info + " (" + this->helper_->getpeername() + ")";
   this->helper_->set_log_info(client_info_);
@@ -900,7 +1022,7 @@ HelloResponse APIConnection::hello(const HelloRequest &msg) {
 
   HelloResponse resp;
   resp.api_version_major = 1;
-  resp.api_version_minor = 7;
+  resp.api_version_minor = 8;
   resp.server_info = App.get_name() + " (esphome v" ESPHOME_VERSION ")";
   resp.name = App.get_name();
 
@@ -949,11 +1071,7 @@ DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
   return resp;
 }
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
-  for (auto &it : this->parent_->get_state_subs()) {
-    if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
-      it.callback(msg.state);
-    }
-  }
+  this->parent_->on_home_assistant_state(msg.entity_id, msg.attribute, msg.state);
 }
 void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
   bool found = false;
@@ -7,6 +7,8 @@
 #include "esphome/core/application.h"
 #include "esphome/core/component.h"
 
+#include <memory>
+
 namespace esphome {
 namespace api {
 
@@ -24,34 +26,41 @@ class APIConnection : public APIServerConnection {
   }
 #ifdef USE_BINARY_SENSOR
   bool send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state);
+  static BinarySensorStateResponse make_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state);
   bool send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor);
 #endif
 #ifdef USE_COVER
   bool send_cover_state(cover::Cover *cover);
+  static CoverStateResponse make_cover_state(cover::Cover *cover);
   bool send_cover_info(cover::Cover *cover);
   void cover_command(const CoverCommandRequest &msg) override;
 #endif
 #ifdef USE_FAN
   bool send_fan_state(fan::Fan *fan);
+  static FanStateResponse make_fan_state(fan::Fan *fan);
   bool send_fan_info(fan::Fan *fan);
   void fan_command(const FanCommandRequest &msg) override;
 #endif
 #ifdef USE_LIGHT
   bool send_light_state(light::LightState *light);
+  static LightStateResponse make_light_state(light::LightState *light);
   bool send_light_info(light::LightState *light);
   void light_command(const LightCommandRequest &msg) override;
 #endif
 #ifdef USE_SENSOR
   bool send_sensor_state(sensor::Sensor *sensor, float state);
+  static SensorStateResponse make_sensor_state(sensor::Sensor *sensor, float state);
   bool send_sensor_info(sensor::Sensor *sensor);
 #endif
 #ifdef USE_SWITCH
   bool send_switch_state(switch_::Switch *a_switch, bool state);
+  static SwitchStateResponse make_switch_state(switch_::Switch *a_switch, bool state);
   bool send_switch_info(switch_::Switch *a_switch);
   void switch_command(const SwitchCommandRequest &msg) override;
 #endif
 #ifdef USE_TEXT_SENSOR
   bool send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state);
+  static TextSensorStateResponse make_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state);
   bool send_text_sensor_info(text_sensor::TextSensor *text_sensor);
 #endif
 #ifdef USE_ESP32_CAMERA
@@ -61,16 +70,19 @@ class APIConnection : public APIServerConnection {
 #endif
 #ifdef USE_CLIMATE
   bool send_climate_state(climate::Climate *climate);
+  static ClimateStateResponse make_climate_state(climate::Climate *climate);
   bool send_climate_info(climate::Climate *climate);
   void climate_command(const ClimateCommandRequest &msg) override;
 #endif
 #ifdef USE_NUMBER
   bool send_number_state(number::Number *number, float state);
+  static NumberStateResponse make_number_state(number::Number *number, float state);
   bool send_number_info(number::Number *number);
   void number_command(const NumberCommandRequest &msg) override;
 #endif
 #ifdef USE_SELECT
   bool send_select_state(select::Select *select, std::string state);
+  static SelectStateResponse make_select_state(select::Select *select, std::string state);
   bool send_select_info(select::Select *select);
   void select_command(const SelectCommandRequest &msg) override;
 #endif
@@ -80,15 +92,22 @@ class APIConnection : public APIServerConnection {
 #endif
 #ifdef USE_LOCK
   bool send_lock_state(lock::Lock *a_lock, lock::LockState state);
+  static LockStateResponse make_lock_state(lock::Lock *a_lock, lock::LockState state);
   bool send_lock_info(lock::Lock *a_lock);
   void lock_command(const LockCommandRequest &msg) override;
 #endif
 #ifdef USE_MEDIA_PLAYER
   bool send_media_player_state(media_player::MediaPlayer *media_player);
+  static MediaPlayerStateResponse make_media_player_state(media_player::MediaPlayer *media_player);
   bool send_media_player_info(media_player::MediaPlayer *media_player);
   void media_player_command(const MediaPlayerCommandRequest &msg) override;
 #endif
   bool send_log_message(int level, const char *tag, const char *line);
+#ifdef USE_API_BINARY_LOGS
+  bool wants_binary_log(int level) const { return this->log_binary_ && level <= this->log_subscription_; }
+  bool send_binary_log_message(int level, const char *tag, int line, const char *format, uint32_t timestamp,
+                               const std::vector<uint8_t> &args);
+#endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
@@ -96,6 +115,7 @@ class APIConnection : public APIServerConnection {
   }
 #ifdef USE_BLUETOOTH_PROXY
   bool send_bluetooth_le_advertisement(const BluetoothLEAdvertisementResponse &msg);
+  bool send_bluetooth_le_raw_advertisements(const BluetoothLERawAdvertisementsResponse &msg);
 
   void bluetooth_device_request(const BluetoothDeviceRequest &msg) override;
   void bluetooth_gatt_read(const BluetoothGATTReadRequest &msg) override;
@@ -136,6 +156,9 @@ class APIConnection : public APIServerConnection {
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->log_subscription_ = msg.level;
+#ifdef USE_API_BINARY_LOGS
+    this->log_binary_ = msg.binary;
+#endif
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -150,7 +173,16 @@ class APIConnection : public APIServerConnection {
   void execute_service(const ExecuteServiceRequest &msg) override;
   void subscribe_bluetooth_le_advertisements(const SubscribeBluetoothLEAdvertisementsRequest &msg) override {
     this->bluetooth_le_advertisement_subscription_ = true;
+    this->bluetooth_le_advertisement_flags_ = msg.flags;
+  }
+#ifdef USE_BLUETOOTH_PROXY
+  /// Whether the client subscribed to advertisements, raw batches if raw is true or parsed ones otherwise.
+  bool is_subscribed_to_bluetooth_le_advertisements(bool raw) const {
+    bool raw_subscription =
+        this->bluetooth_le_advertisement_flags_ & enums::BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_RAW_ADVERTISEMENTS;
+    return this->bluetooth_le_advertisement_subscription_ && raw_subscription == raw;
   }
+#endif
   bool is_authenticated() override { return this->connection_state_ == ConnectionState::AUTHENTICATED; }
   bool is_connection_setup() override {
     return this->connection_state_ == ConnectionState ::CONNECTED || this->is_authenticated();
@@ -164,11 +196,21 @@ class APIConnection : public APIServerConnection {
     return {&this->proto_write_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
+  /// Send a state message that was already encoded by the server, if states are subscribed.
+  bool send_encoded_state(std::vector<uint8_t> &payload, uint32_t message_type) {
+    if (!this->state_subscription_)
+      return false;
+    return this->send_buffer(ProtoWriteBuffer{&payload}, message_type);
+  }
+  bool is_state_subscribed() const { return this->state_subscription_; }
 
  protected:
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+#ifdef USE_API_BINARY_LOGS
+  bool get_log_string_id_(const char *value, bool is_static, uint32_t *id);
+#endif
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -192,10 +234,31 @@ class APIConnection : public APIServerConnection {
 
   bool state_subscription_{false};
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+#ifdef USE_API_BINARY_LOGS
+  bool log_binary_{false};
+  /// The binary message couldn't be sent because the string table is full, send the text line instead
+  bool log_text_fallback_{false};
+  struct LogString {
+    const char *value;
+    uint32_t id;
+  };
+  /// Slots of the open addressing table of the sent strings, and how many of them can be used.
+  static const uint8_t LOG_STRINGS_SIZE = 64;
+  static const uint8_t MAX_LOG_STRINGS = 48;
+  /// The tags and format strings already sent to the client, keyed by their address as they are static. Allocated when
+  /// the first binary log message is sent.
+  std::unique_ptr<LogString[]> log_strings_;
+  uint8_t log_strings_count_{0};
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  /// The format strings are copied out of flash into the logger's buffer, so these are keyed by the hash of a copy.
+  std::vector<std::unique_ptr<char[]>> log_string_copies_;
+#endif
+#endif
   uint32_t last_traffic_;
   bool sent_ping_{false};
   bool service_call_subscription_{false};
   bool bluetooth_le_advertisement_subscription_{false};
+  uint32_t bluetooth_le_advertisement_flags_{0};
   bool next_close_ = false;
   APIServer *parent_;
   InitialStateIterator initial_state_iterator_;
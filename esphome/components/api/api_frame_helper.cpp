@@ -20,6 +20,40 @@ bool is_would_block(ssize_t ret) {
   return ret == 0;
 }
 
+/// Append the data of iov, minus the first skip bytes, to the send buffer.
+static void buffer_iov(SendBuffer &tx_buf, const struct iovec *iov, int iovcnt, size_t skip) {
+  auto &data = tx_buf.data;
+  if (tx_buf.offset != 0 && tx_buf.offset >= data.size() / 2) {
+    // Move the unsent data to the front instead of growing the buffer, this copies at most as much as is appended
+    data.erase(data.begin(), data.begin() + tx_buf.offset);
+    tx_buf.offset = 0;
+  }
+  for (int i = 0; i < iovcnt; i++) {
+    auto *base = reinterpret_cast<uint8_t *>(iov[i].iov_base);
+    if (skip >= iov[i].iov_len) {
+      skip -= iov[i].iov_len;
+      continue;
+    }
+    data.insert(data.end(), base + skip, base + iov[i].iov_len);
+    skip = 0;
+  }
+}
+
+/// Write the unsent data of the send buffer with a single write() call, returns the write() result.
+static ssize_t write_tx_buf(socket::Socket *socket, SendBuffer &tx_buf) {
+  ssize_t sent = socket->write(tx_buf.current_data(), tx_buf.current_size());
+  if (sent <= 0)
+    return sent;
+
+  tx_buf.offset += sent;
+  if (tx_buf.empty()) {
+    // Keeps the capacity for the next frames that have to wait
+    tx_buf.data.clear();
+    tx_buf.offset = 0;
+  }
+  return sent;
+}
+
 const char *api_error_to_str(APIError err) {
   // not using switch to ensure compiler doesn't try to build a big table out of it
   if (err == APIError::OK) {
@@ -180,6 +214,15 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
     HELPER_LOG("Bad argument for try_read_frame_");
     return APIError::BAD_ARG;
   }
+  if (rx_consume_len_ != 0) {
+    // the previous frame was parsed in place and has been handled by now, release it
+    socket_->consume(rx_consume_len_);
+    rx_consume_len_ = 0;
+  }
+  if (!socket_->ready()) {
+    // Nothing arrived since the last time, skip the read syscall
+    return APIError::WOULD_BLOCK;
+  }
 
   // read header
   if (rx_header_buf_len_ < 3) {
@@ -224,12 +267,26 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
     return APIError::BAD_HANDSHAKE_PACKET_LEN;
   }
 
-  // reserve space for body
-  if (rx_buf_.size() != msg_size) {
-    rx_buf_.resize(msg_size);
+  uint8_t *msg = nullptr;
+  if (rx_buf_len_ == 0 && msg_size != 0) {
+    // if the socket holds the whole body in one chunk, decrypt it in place instead of copying it to rx_buf_
+    uint8_t *data;
+    ssize_t available = socket_->peek(&data);
+    if (available >= (ssize_t) msg_size) {
+      msg = data;
+      rx_consume_len_ = msg_size;
+    }
+  }
+
+  if (msg == nullptr) {
+    // reserve space for body, only reallocates if the capacity of previous frames isn't enough
+    if (rx_buf_.size() != msg_size) {
+      rx_buf_.resize(msg_size);
+    }
+    msg = rx_buf_.data();
   }
 
-  if (rx_buf_len_ < msg_size) {
+  if (rx_consume_len_ == 0 && rx_buf_len_ < msg_size) {
     // more data to read
     size_t to_read = msg_size - rx_buf_len_;
     ssize_t received = socket_->read(&rx_buf_[rx_buf_len_], to_read);
@@ -254,11 +311,11 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
 
   // uncomment for even more debugging
 #ifdef HELPER_LOG_PACKETS
-  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
+  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(msg, msg_size).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
-  // consume msg
-  rx_buf_ = {};
+  frame->msg = msg;
+  frame->msg_len = msg_size;
+  // consume msg, but keep the buffer around for the next one
   rx_buf_len_ = 0;
   rx_header_buf_len_ = 0;
   return APIError::OK;
@@ -295,9 +352,9 @@ APIError APINoiseFrameHelper::state_action_() {
     if (aerr != APIError::OK)
       return aerr;
     // ignore contents, may be used in future for flags
-    prologue_.push_back((uint8_t)(frame.msg.size() >> 8));
-    prologue_.push_back((uint8_t) frame.msg.size());
-    prologue_.insert(prologue_.end(), frame.msg.begin(), frame.msg.end());
+    prologue_.push_back((uint8_t)(frame.msg_len >> 8));
+    prologue_.push_back((uint8_t) frame.msg_len);
+    prologue_.insert(prologue_.end(), frame.msg, frame.msg + frame.msg_len);
 
     state_ = State::SERVER_HELLO;
   }
@@ -340,7 +397,7 @@ APIError APINoiseFrameHelper::state_action_() {
       if (aerr != APIError::OK)
         return aerr;
 
-      if (frame.msg.empty()) {
+      if (frame.msg_len == 0) {
         send_explicit_handshake_reject_("Empty handshake message");
         return APIError::BAD_HANDSHAKE_ERROR_BYTE;
       } else if (frame.msg[0] != 0x00) {
@@ -351,7 +408,7 @@ APIError APINoiseFrameHelper::state_action_() {
 
       NoiseBuffer mbuf;
       noise_buffer_init(mbuf);
-      noise_buffer_set_input(mbuf, frame.msg.data() + 1, frame.msg.size() - 1);
+      noise_buffer_set_input(mbuf, frame.msg + 1, frame.msg_len - 1);
       err = noise_handshakestate_read_message(handshake_, &mbuf, nullptr);
       if (err != 0) {
         state_ = State::FAILED;
@@ -432,7 +489,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, frame.msg.data(), frame.msg.size(), frame.msg.size());
+  noise_buffer_set_inout(mbuf, frame.msg, frame.msg_len, frame.msg_len);
   err = noise_cipherstate_decrypt(recv_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -441,7 +498,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   }
 
   size_t msg_size = mbuf.size;
-  uint8_t *msg_data = frame.msg.data();
+  uint8_t *msg_data = frame.msg;
   if (msg_size < 4) {
     state_ = State::FAILED;
     HELPER_LOG("Bad data packet: size %d too short", msg_size);
@@ -460,7 +517,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
     return APIError::BAD_DATA_PACKET;
   }
 
-  buffer->container = std::move(frame.msg);
+  buffer->container = frame.msg;
   buffer->data_offset = 4;
   buffer->data_len = data_len;
   buffer->type = type;
@@ -482,11 +539,17 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   size_t padding = 0;
   size_t msg_len = 4 + payload_len + padding;
   size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  // re-use the buffer of previous packets, it only grows if this packet is larger
+  if (frame_len > tx_frame_buf_size_) {
+    tx_frame_buf_.reset(new (std::nothrow) uint8_t[frame_len]);
+    if (tx_frame_buf_ == nullptr) {
+      tx_frame_buf_size_ = 0;
+      HELPER_LOG("Could not allocate for writing packet");
+      return APIError::OUT_OF_MEMORY;
+    }
+    tx_frame_buf_size_ = frame_len;
   }
+  uint8_t *tmpbuf = tx_frame_buf_.get();
 
   tmpbuf[0] = 0x01;  // indicator
   // tmpbuf[1], tmpbuf[2] to be set later
@@ -523,21 +586,16 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   return write_raw_(&iov, 1);
 }
 APIError APINoiseFrameHelper::try_send_tx_buf_() {
-  // try send from tx_buf
+  // try send from tx_buf, multiple queued packets per write
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
-    if (sent == -1) {
-      if (errno == EWOULDBLOCK || errno == EAGAIN)
-        break;
+    ssize_t sent = write_tx_buf(socket_.get(), tx_buf_);
+    if (is_would_block(sent)) {
+      break;
+    } else if (sent == -1) {
       state_ = State::FAILED;
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
-    } else if (sent == 0) {
-      break;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
   }
 
   return APIError::OK;
@@ -570,20 +628,14 @@ APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
 
   if (!tx_buf_.empty()) {
     // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
+    buffer_iov(tx_buf_, iov, iovcnt, 0);
     return APIError::OK;
   }
 
   ssize_t sent = socket_->writev(iov, iovcnt);
   if (is_would_block(sent)) {
     // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
+    buffer_iov(tx_buf_, iov, iovcnt, 0);
     return APIError::OK;
   } else if (sent == -1) {
     // an error occurred
@@ -592,16 +644,7 @@ APIError APINoiseFrameHelper::write_raw_(const struct iovec *iov, int iovcnt) {
     return APIError::SOCKET_WRITE_FAILED;
   } else if ((size_t) sent != total_write_len) {
     // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
-    }
+    buffer_iov(tx_buf_, iov, iovcnt, sent);
     return APIError::OK;
   }
   // fully sent
@@ -793,6 +836,15 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
     HELPER_LOG("Bad argument for try_read_frame_");
     return APIError::BAD_ARG;
   }
+  if (rx_consume_len_ != 0) {
+    // the previous frame was parsed in place and has been handled by now, release it
+    socket_->consume(rx_consume_len_);
+    rx_consume_len_ = 0;
+  }
+  if (!socket_->ready()) {
+    // Nothing arrived since the last time, skip the read syscall
+    return APIError::WOULD_BLOCK;
+  }
 
   // read header
   while (!rx_header_parsed_) {
@@ -840,12 +892,26 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
   }
   // header reading done
 
-  // reserve space for body
-  if (rx_buf_.size() != rx_header_parsed_len_) {
-    rx_buf_.resize(rx_header_parsed_len_);
+  uint8_t *msg = nullptr;
+  if (rx_buf_len_ == 0 && rx_header_parsed_len_ != 0) {
+    // if the socket holds the whole body in one chunk, parse it in place instead of copying it to rx_buf_
+    uint8_t *data;
+    ssize_t available = socket_->peek(&data);
+    if (available >= (ssize_t) rx_header_parsed_len_) {
+      msg = data;
+      rx_consume_len_ = rx_header_parsed_len_;
+    }
+  }
+
+  if (msg == nullptr) {
+    // reserve space for body, only reallocates if the capacity of previous frames isn't enough
+    if (rx_buf_.size() != rx_header_parsed_len_) {
+      rx_buf_.resize(rx_header_parsed_len_);
+    }
+    msg = rx_buf_.data();
   }
 
-  if (rx_buf_len_ < rx_header_parsed_len_) {
+  if (rx_consume_len_ == 0 && rx_buf_len_ < rx_header_parsed_len_) {
     // more data to read
     size_t to_read = rx_header_parsed_len_ - rx_buf_len_;
     ssize_t received = socket_->read(&rx_buf_[rx_buf_len_], to_read);
@@ -870,11 +936,11 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
 
   // uncomment for even more debugging
 #ifdef HELPER_LOG_PACKETS
-  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
+  ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(msg, rx_header_parsed_len_).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
-  // consume msg
-  rx_buf_ = {};
+  frame->msg = msg;
+  frame->msg_len = rx_header_parsed_len_;
+  // consume msg, but keep the buffers around for the next one
   rx_buf_len_ = 0;
   rx_header_buf_.clear();
   rx_header_parsed_ = false;
@@ -893,7 +959,7 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   if (aerr != APIError::OK)
     return aerr;
 
-  buffer->container = std::move(frame.msg);
+  buffer->container = frame.msg;
   buffer->data_offset = 0;
   buffer->data_len = rx_header_parsed_len_;
   buffer->type = rx_header_parsed_type_;
@@ -905,23 +971,30 @@ APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *pay
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  // indicator, payload length and type varints
+  uint8_t header[1 + 5 + 3];
+  size_t header_len = 0;
+  header[header_len++] = 0x00;
+  for (uint32_t value : {static_cast<uint32_t>(payload_len), static_cast<uint32_t>(type)}) {
+    while (value > 0x7F) {
+      header[header_len++] = (uint8_t)(value & 0x7F) | 0x80;
+      value >>= 7;
+    }
+    header[header_len++] = (uint8_t) value;
+  }
 
   struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
+  iov[0].iov_base = header;
+  iov[0].iov_len = header_len;
   iov[1].iov_base = const_cast<uint8_t *>(payload);
   iov[1].iov_len = payload_len;
 
   return write_raw_(iov, 2);
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
-  // try send from tx_buf
+  // try send from tx_buf, multiple queued packets per write
   while (state_ != State::CLOSED && !tx_buf_.empty()) {
-    ssize_t sent = socket_->write(tx_buf_.data(), tx_buf_.size());
+    ssize_t sent = write_tx_buf(socket_.get(), tx_buf_);
     if (is_would_block(sent)) {
       break;
     } else if (sent == -1) {
@@ -929,9 +1002,6 @@ APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
       HELPER_LOG("Socket write failed with errno %d", errno);
       return APIError::SOCKET_WRITE_FAILED;
     }
-    // TODO: inefficient if multiple packets in txbuf
-    // replace with deque of buffers
-    tx_buf_.erase(tx_buf_.begin(), tx_buf_.begin() + sent);
   }
 
   return APIError::OK;
@@ -964,20 +1034,14 @@ APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt
 
   if (!tx_buf_.empty()) {
     // tx buf not empty, can't write now because then stream would be inconsistent
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
+    buffer_iov(tx_buf_, iov, iovcnt, 0);
     return APIError::OK;
   }
 
   ssize_t sent = socket_->writev(iov, iovcnt);
   if (is_would_block(sent)) {
     // operation would block, add buffer to tx_buf
-    for (int i = 0; i < iovcnt; i++) {
-      tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base),
-                     reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-    }
+    buffer_iov(tx_buf_, iov, iovcnt, 0);
     return APIError::OK;
   } else if (sent == -1) {
     // an error occurred
@@ -986,16 +1050,7 @@ APIError APIPlaintextFrameHelper::write_raw_(const struct iovec *iov, int iovcnt
     return APIError::SOCKET_WRITE_FAILED;
   } else if ((size_t) sent != total_write_len) {
     // partially sent, add end to tx_buf
-    size_t to_consume = sent;
-    for (int i = 0; i < iovcnt; i++) {
-      if (to_consume >= iov[i].iov_len) {
-        to_consume -= iov[i].iov_len;
-      } else {
-        tx_buf_.insert(tx_buf_.end(), reinterpret_cast<uint8_t *>(iov[i].iov_base) + to_consume,
-                       reinterpret_cast<uint8_t *>(iov[i].iov_base) + iov[i].iov_len);
-        to_consume = 0;
-      }
-    }
+    buffer_iov(tx_buf_, iov, iovcnt, sent);
     return APIError::OK;
   }
   // fully sent
@@ -1,6 +1,5 @@
 #pragma once
 #include <cstdint>
-#include <deque>
 #include <utility>
 #include <vector>
 
@@ -17,12 +16,28 @@ namespace esphome {
 namespace api {
 
 struct ReadPacketBuffer {
-  std::vector<uint8_t> container;
+  /// Points into the receive buffer of the frame helper, only valid until the next read_packet() call.
+  uint8_t *container;
   uint16_t type;
   size_t data_offset;
   size_t data_len;
 };
 
+/** Outgoing data that couldn't be written to the socket yet.
+ *
+ * All queued frames share one byte buffer that keeps its capacity when it is drained, so queuing frames while the
+ * socket is busy only allocates until the buffer has grown to the usual backlog.
+ */
+struct SendBuffer {
+  std::vector<uint8_t> data;
+  /// Number of bytes of data that have been sent already.
+  size_t offset{0};
+
+  bool empty() const { return this->offset == this->data.size(); }
+  uint8_t *current_data() { return this->data.data() + this->offset; }
+  size_t current_size() const { return this->data.size() - this->offset; }
+};
+
 struct PacketBuffer {
   const std::vector<uint8_t> container;
   uint16_t type;
@@ -92,7 +107,9 @@ class APINoiseFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    /// Points into rx_buf_ or the receive buffer of the socket, only valid until the next try_read_frame_() call.
+    uint8_t *msg;
+    size_t msg_len;
   };
 
   APIError state_action_();
@@ -109,10 +126,16 @@ class APINoiseFrameHelper : public APIFrameHelper {
   std::string info_;
   uint8_t rx_header_buf_[3];
   size_t rx_header_buf_len_ = 0;
+  // Kept between frames so that its capacity is re-used
   std::vector<uint8_t> rx_buf_;
   size_t rx_buf_len_ = 0;
+  // Length of the frame that was parsed in place in the socket's receive buffer, released on the next read
+  size_t rx_consume_len_ = 0;
 
-  std::vector<uint8_t> tx_buf_;
+  SendBuffer tx_buf_;
+  // Re-used to prevent allocations when encrypting, only grows when a packet doesn't fit
+  std::unique_ptr<uint8_t[]> tx_frame_buf_;
+  size_t tx_frame_buf_size_ = 0;
   std::vector<uint8_t> prologue_;
 
   std::shared_ptr<APINoiseContext> ctx_;
@@ -152,7 +175,9 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
 
  protected:
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    /// Points into rx_buf_ or the receive buffer of the socket, only valid until the next try_read_frame_() call.
+    uint8_t *msg;
+    size_t msg_len;
   };
 
   APIError try_read_frame_(ParsedFrame *frame);
@@ -166,11 +191,14 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   bool rx_header_parsed_ = false;
   uint32_t rx_header_parsed_type_ = 0;
   uint32_t rx_header_parsed_len_ = 0;
+  // Length of the frame that was parsed in place in the socket's receive buffer, released on the next read
+  size_t rx_consume_len_ = 0;
 
+  // Kept between frames so that its capacity is re-used
   std::vector<uint8_t> rx_buf_;
   size_t rx_buf_len_ = 0;
 
-  std::vector<uint8_t> tx_buf_;
+  SendBuffer tx_buf_;
 
   enum class State {
     INITIALIZE = 1,
@@ -3,6 +3,12 @@
 #include "api_pb2.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_API_PROTO_TABLES
+#include <cstddef>
+// Messages are polymorphic, offsetof() on them is conditionally-supported but works with GCC and clang
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
 namespace esphome {
 namespace api {
 
@@ -341,6 +347,17 @@ template<> const char *proto_enum_to_string<enums::MediaPlayerCommand>(enums::Me
   }
 }
 template<>
+const char *proto_enum_to_string<enums::BluetoothProxySubscriptionFlag>(enums::BluetoothProxySubscriptionFlag value) {
+  switch (value) {
+    case enums::BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_NONE:
+      return "BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_NONE";
+    case enums::BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_RAW_ADVERTISEMENTS:
+      return "BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_RAW_ADVERTISEMENTS";
+    default:
+      return "UNKNOWN";
+  }
+}
+template<>
 const char *proto_enum_to_string<enums::BluetoothDeviceRequestType>(enums::BluetoothDeviceRequestType value) {
   switch (value) {
     case enums::BLUETOOTH_DEVICE_REQUEST_TYPE_CONNECT:
@@ -355,6 +372,15 @@ const char *proto_enum_to_string<enums::BluetoothDeviceRequestType>(enums::Bluet
       return "UNKNOWN";
   }
 }
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t HELLO_REQUEST_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo HELLO_REQUEST_FIELDS[] = {
+    {offsetof(HelloRequest, client_info), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(HelloRequest, api_version_major), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(HelloRequest, api_version_minor), 3, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable HelloRequest::get_field_table() const { return {HELLO_REQUEST_FIELDS, 3, HELLO_REQUEST_INDEX, 4}; }
+#else
 bool HelloRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -384,6 +410,7 @@ void HelloRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->api_version_major);
   buffer.encode_uint32(3, this->api_version_minor);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HelloRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -404,6 +431,16 @@ void HelloRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t HELLO_RESPONSE_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo HELLO_RESPONSE_FIELDS[] = {
+    {offsetof(HelloResponse, api_version_major), 1, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(HelloResponse, api_version_minor), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(HelloResponse, server_info), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(HelloResponse, name), 4, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable HelloResponse::get_field_table() const { return {HELLO_RESPONSE_FIELDS, 4, HELLO_RESPONSE_INDEX, 5}; }
+#else
 bool HelloResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -438,6 +475,7 @@ void HelloResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->server_info);
   buffer.encode_string(4, this->name);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HelloResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -462,6 +500,15 @@ void HelloResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t CONNECT_REQUEST_INDEX[] = {0, 1};
+static const ProtoFieldInfo CONNECT_REQUEST_FIELDS[] = {
+    {offsetof(ConnectRequest, password), 1, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable ConnectRequest::get_field_table() const {
+  return {CONNECT_REQUEST_FIELDS, 1, CONNECT_REQUEST_INDEX, 2};
+}
+#else
 bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
@@ -473,6 +520,7 @@ bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value
   }
 }
 void ConnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->password); }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ConnectRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -483,6 +531,15 @@ void ConnectRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t CONNECT_RESPONSE_INDEX[] = {0, 1};
+static const ProtoFieldInfo CONNECT_RESPONSE_FIELDS[] = {
+    {offsetof(ConnectResponse, invalid_password), 1, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable ConnectResponse::get_field_table() const {
+  return {CONNECT_RESPONSE_FIELDS, 1, CONNECT_RESPONSE_INDEX, 2};
+}
+#else
 bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -494,6 +551,7 @@ bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   }
 }
 void ConnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ConnectResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -504,26 +562,65 @@ void ConnectResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable DisconnectRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void DisconnectRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DisconnectRequest::dump_to(std::string &out) const { out.append("DisconnectRequest {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable DisconnectResponse::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void DisconnectResponse::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DisconnectResponse::dump_to(std::string &out) const { out.append("DisconnectResponse {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable PingRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void PingRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void PingRequest::dump_to(std::string &out) const { out.append("PingRequest {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable PingResponse::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void PingResponse::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void PingResponse::dump_to(std::string &out) const { out.append("PingResponse {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable DeviceInfoRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DeviceInfoRequest::dump_to(std::string &out) const { out.append("DeviceInfoRequest {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t DEVICE_INFO_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const ProtoFieldInfo DEVICE_INFO_RESPONSE_FIELDS[] = {
+    {offsetof(DeviceInfoResponse, uses_password), 1, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(DeviceInfoResponse, name), 2, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, mac_address), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, esphome_version), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, compilation_time), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, model), 6, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, has_deep_sleep), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(DeviceInfoResponse, project_name), 8, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, project_version), 9, PROTO_FIELD_STRING, nullptr},
+    {offsetof(DeviceInfoResponse, webserver_port), 10, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(DeviceInfoResponse, bluetooth_proxy_version), 11, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable DeviceInfoResponse::get_field_table() const {
+  return {DEVICE_INFO_RESPONSE_FIELDS, 11, DEVICE_INFO_RESPONSE_INDEX, 12};
+}
+#else
 bool DeviceInfoResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -593,6 +690,7 @@ void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(10, this->webserver_port);
   buffer.encode_uint32(11, this->bluetooth_proxy_version);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void DeviceInfoResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -645,18 +743,47 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable ListEntitiesRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable ListEntitiesDoneResponse::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable SubscribeStatesRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_BINARY_SENSOR_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+static const ProtoFieldInfo LIST_ENTITIES_BINARY_SENSOR_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesBinarySensorResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, device_class), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, is_status_binary_sensor), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, disabled_by_default), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, icon), 8, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesBinarySensorResponse, entity_category), 9, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesBinarySensorResponse::get_field_table() const {
+  return {LIST_ENTITIES_BINARY_SENSOR_RESPONSE_FIELDS, 9, LIST_ENTITIES_BINARY_SENSOR_RESPONSE_INDEX, 10};
+}
+#else
 bool ListEntitiesBinarySensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -722,6 +849,7 @@ void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(8, this->icon);
   buffer.encode_enum<enums::EntityCategory>(9, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -765,6 +893,17 @@ void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BINARY_SENSOR_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BINARY_SENSOR_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(BinarySensorStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(BinarySensorStateResponse, state), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(BinarySensorStateResponse, missing_state), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable BinarySensorStateResponse::get_field_table() const {
+  return {BINARY_SENSOR_STATE_RESPONSE_FIELDS, 3, BINARY_SENSOR_STATE_RESPONSE_INDEX, 4};
+}
+#else
 bool BinarySensorStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -794,6 +933,7 @@ void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BinarySensorStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -813,6 +953,25 @@ void BinarySensorStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_COVER_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const ProtoFieldInfo LIST_ENTITIES_COVER_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesCoverResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCoverResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesCoverResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCoverResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCoverResponse, assumed_state), 5, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesCoverResponse, supports_position), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesCoverResponse, supports_tilt), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesCoverResponse, device_class), 8, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCoverResponse, disabled_by_default), 9, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesCoverResponse, icon), 10, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCoverResponse, entity_category), 11, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesCoverResponse::get_field_table() const {
+  return {LIST_ENTITIES_COVER_RESPONSE_FIELDS, 11, LIST_ENTITIES_COVER_RESPONSE_INDEX, 12};
+}
+#else
 bool ListEntitiesCoverResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 5: {
@@ -888,6 +1047,7 @@ void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(10, this->icon);
   buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesCoverResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -939,6 +1099,19 @@ void ListEntitiesCoverResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t COVER_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5};
+static const ProtoFieldInfo COVER_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(CoverStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(CoverStateResponse, legacy_state), 2, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(CoverStateResponse, position), 3, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(CoverStateResponse, tilt), 4, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(CoverStateResponse, current_operation), 5, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable CoverStateResponse::get_field_table() const {
+  return {COVER_STATE_RESPONSE_FIELDS, 5, COVER_STATE_RESPONSE_INDEX, 6};
+}
+#else
 bool CoverStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -978,6 +1151,7 @@ void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(4, this->tilt);
   buffer.encode_enum<enums::CoverOperation>(5, this->current_operation);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CoverStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1007,6 +1181,22 @@ void CoverStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t COVER_COMMAND_REQUEST_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const ProtoFieldInfo COVER_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(CoverCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(CoverCommandRequest, has_legacy_command), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(CoverCommandRequest, legacy_command), 3, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(CoverCommandRequest, has_position), 4, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(CoverCommandRequest, position), 5, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(CoverCommandRequest, has_tilt), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(CoverCommandRequest, tilt), 7, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(CoverCommandRequest, stop), 8, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable CoverCommandRequest::get_field_table() const {
+  return {COVER_COMMAND_REQUEST_FIELDS, 8, COVER_COMMAND_REQUEST_INDEX, 9};
+}
+#else
 bool CoverCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -1061,6 +1251,7 @@ void CoverCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(7, this->tilt);
   buffer.encode_bool(8, this->stop);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CoverCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1102,6 +1293,25 @@ void CoverCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_FAN_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const ProtoFieldInfo LIST_ENTITIES_FAN_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesFanResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesFanResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesFanResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesFanResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesFanResponse, supports_oscillation), 5, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesFanResponse, supports_speed), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesFanResponse, supports_direction), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesFanResponse, supported_speed_count), 8, PROTO_FIELD_INT32, nullptr},
+    {offsetof(ListEntitiesFanResponse, disabled_by_default), 9, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesFanResponse, icon), 10, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesFanResponse, entity_category), 11, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesFanResponse::get_field_table() const {
+  return {LIST_ENTITIES_FAN_RESPONSE_FIELDS, 11, LIST_ENTITIES_FAN_RESPONSE_INDEX, 12};
+}
+#else
 bool ListEntitiesFanResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 5: {
@@ -1177,6 +1387,7 @@ void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(10, this->icon);
   buffer.encode_enum<enums::EntityCategory>(11, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesFanResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1229,6 +1440,20 @@ void ListEntitiesFanResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t FAN_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6};
+static const ProtoFieldInfo FAN_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(FanStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(FanStateResponse, state), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanStateResponse, oscillating), 3, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanStateResponse, speed), 4, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(FanStateResponse, direction), 5, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(FanStateResponse, speed_level), 6, PROTO_FIELD_INT32, nullptr},
+};
+ProtoFieldTable FanStateResponse::get_field_table() const {
+  return {FAN_STATE_RESPONSE_FIELDS, 6, FAN_STATE_RESPONSE_INDEX, 7};
+}
+#else
 bool FanStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -1273,6 +1498,7 @@ void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::FanDirection>(5, this->direction);
   buffer.encode_int32(6, this->speed_level);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void FanStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1305,6 +1531,25 @@ void FanStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t FAN_COMMAND_REQUEST_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const ProtoFieldInfo FAN_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(FanCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(FanCommandRequest, has_state), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, state), 3, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, has_speed), 4, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, speed), 5, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(FanCommandRequest, has_oscillating), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, oscillating), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, has_direction), 8, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, direction), 9, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(FanCommandRequest, has_speed_level), 10, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(FanCommandRequest, speed_level), 11, PROTO_FIELD_INT32, nullptr},
+};
+ProtoFieldTable FanCommandRequest::get_field_table() const {
+  return {FAN_COMMAND_REQUEST_FIELDS, 11, FAN_COMMAND_REQUEST_INDEX, 12};
+}
+#else
 bool FanCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -1374,6 +1619,7 @@ void FanCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(10, this->has_speed_level);
   buffer.encode_int32(11, this->speed_level);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void FanCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1426,6 +1672,30 @@ void FanCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_LIGHT_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 5, 13, 14, 15};
+static const ProtoFieldInfo LIST_ENTITIES_LIGHT_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesLightResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLightResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesLightResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLightResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLightResponse, supported_color_modes), 12, PROTO_FIELD_ENUM,
+     &ProtoRepeated<enums::ColorMode>::OPS},
+    {offsetof(ListEntitiesLightResponse, legacy_supports_brightness), 5, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLightResponse, legacy_supports_rgb), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLightResponse, legacy_supports_white_value), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLightResponse, legacy_supports_color_temperature), 8, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLightResponse, min_mireds), 9, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesLightResponse, max_mireds), 10, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesLightResponse, effects), 11, PROTO_FIELD_STRING, &ProtoRepeated<std::string>::OPS},
+    {offsetof(ListEntitiesLightResponse, disabled_by_default), 13, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLightResponse, icon), 14, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLightResponse, entity_category), 15, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesLightResponse::get_field_table() const {
+  return {LIST_ENTITIES_LIGHT_RESPONSE_FIELDS, 15, LIST_ENTITIES_LIGHT_RESPONSE_INDEX, 16};
+}
+#else
 bool ListEntitiesLightResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 12: {
@@ -1525,6 +1795,7 @@ void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(14, this->icon);
   buffer.encode_enum<enums::EntityCategory>(15, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesLightResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1598,6 +1869,27 @@ void ListEntitiesLightResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIGHT_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3, 6, 7, 8, 9, 10, 13, 5, 4, 11, 12};
+static const ProtoFieldInfo LIGHT_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(LightStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(LightStateResponse, state), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightStateResponse, brightness), 3, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, color_mode), 11, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(LightStateResponse, color_brightness), 10, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, red), 4, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, green), 5, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, blue), 6, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, white), 7, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, color_temperature), 8, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, cold_white), 12, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, warm_white), 13, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightStateResponse, effect), 9, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable LightStateResponse::get_field_table() const {
+  return {LIGHT_STATE_RESPONSE_FIELDS, 13, LIGHT_STATE_RESPONSE_INDEX, 14};
+}
+#else
 bool LightStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -1683,6 +1975,7 @@ void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(13, this->warm_white);
   buffer.encode_string(9, this->effect);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -1751,6 +2044,42 @@ void LightStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIGHT_COMMAND_REQUEST_INDEX[] = {
+    0, 1, 2, 3, 4, 5, 10, 11, 12, 13, 14, 15, 16, 17, 22, 23, 24, 25, 26, 27, 8, 9, 6, 7, 18, 19, 20, 21};
+static const ProtoFieldInfo LIGHT_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(LightCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(LightCommandRequest, has_state), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, state), 3, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, has_brightness), 4, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, brightness), 5, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_color_mode), 22, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, color_mode), 23, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(LightCommandRequest, has_color_brightness), 20, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, color_brightness), 21, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_rgb), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, red), 7, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, green), 8, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, blue), 9, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_white), 10, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, white), 11, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_color_temperature), 12, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, color_temperature), 13, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_cold_white), 24, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, cold_white), 25, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_warm_white), 26, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, warm_white), 27, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(LightCommandRequest, has_transition_length), 14, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, transition_length), 15, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(LightCommandRequest, has_flash_length), 16, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, flash_length), 17, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(LightCommandRequest, has_effect), 18, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LightCommandRequest, effect), 19, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable LightCommandRequest::get_field_table() const {
+  return {LIGHT_COMMAND_REQUEST_FIELDS, 27, LIGHT_COMMAND_REQUEST_INDEX, 28};
+}
+#else
 bool LightCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -1906,6 +2235,7 @@ void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(18, this->has_effect);
   buffer.encode_string(19, this->effect);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2032,6 +2362,27 @@ void LightCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_SENSOR_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+static const ProtoFieldInfo LIST_ENTITIES_SENSOR_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesSensorResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSensorResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesSensorResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSensorResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSensorResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSensorResponse, unit_of_measurement), 6, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSensorResponse, accuracy_decimals), 7, PROTO_FIELD_INT32, nullptr},
+    {offsetof(ListEntitiesSensorResponse, force_update), 8, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesSensorResponse, device_class), 9, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSensorResponse, state_class), 10, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesSensorResponse, legacy_last_reset_type), 11, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesSensorResponse, disabled_by_default), 12, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesSensorResponse, entity_category), 13, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesSensorResponse::get_field_table() const {
+  return {LIST_ENTITIES_SENSOR_RESPONSE_FIELDS, 13, LIST_ENTITIES_SENSOR_RESPONSE_INDEX, 14};
+}
+#else
 bool ListEntitiesSensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 7: {
@@ -2117,6 +2468,7 @@ void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(12, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(13, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2177,6 +2529,17 @@ void ListEntitiesSensorResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SENSOR_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo SENSOR_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(SensorStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(SensorStateResponse, state), 2, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(SensorStateResponse, missing_state), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable SensorStateResponse::get_field_table() const {
+  return {SENSOR_STATE_RESPONSE_FIELDS, 3, SENSOR_STATE_RESPONSE_INDEX, 4};
+}
+#else
 bool SensorStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 3: {
@@ -2206,6 +2569,7 @@ void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SensorStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2226,6 +2590,23 @@ void SensorStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_SWITCH_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+static const ProtoFieldInfo LIST_ENTITIES_SWITCH_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesSwitchResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, assumed_state), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, disabled_by_default), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, entity_category), 8, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesSwitchResponse, device_class), 9, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable ListEntitiesSwitchResponse::get_field_table() const {
+  return {LIST_ENTITIES_SWITCH_RESPONSE_FIELDS, 9, LIST_ENTITIES_SWITCH_RESPONSE_INDEX, 10};
+}
+#else
 bool ListEntitiesSwitchResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -2291,6 +2672,7 @@ void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
   buffer.encode_string(9, this->device_class);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2334,6 +2716,16 @@ void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SWITCH_STATE_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo SWITCH_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(SwitchStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(SwitchStateResponse, state), 2, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable SwitchStateResponse::get_field_table() const {
+  return {SWITCH_STATE_RESPONSE_FIELDS, 2, SWITCH_STATE_RESPONSE_INDEX, 3};
+}
+#else
 bool SwitchStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -2358,6 +2750,7 @@ void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SwitchStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2373,6 +2766,16 @@ void SwitchStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SWITCH_COMMAND_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo SWITCH_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(SwitchCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(SwitchCommandRequest, state), 2, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable SwitchCommandRequest::get_field_table() const {
+  return {SWITCH_COMMAND_REQUEST_FIELDS, 2, SWITCH_COMMAND_REQUEST_INDEX, 3};
+}
+#else
 bool SwitchCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -2397,6 +2800,7 @@ void SwitchCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SwitchCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2412,6 +2816,21 @@ void SwitchCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_TEXT_SENSOR_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7};
+static const ProtoFieldInfo LIST_ENTITIES_TEXT_SENSOR_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesTextSensorResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesTextSensorResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesTextSensorResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesTextSensorResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesTextSensorResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesTextSensorResponse, disabled_by_default), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesTextSensorResponse, entity_category), 7, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesTextSensorResponse::get_field_table() const {
+  return {LIST_ENTITIES_TEXT_SENSOR_RESPONSE_FIELDS, 7, LIST_ENTITIES_TEXT_SENSOR_RESPONSE_INDEX, 8};
+}
+#else
 bool ListEntitiesTextSensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -2467,6 +2886,7 @@ void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2502,6 +2922,17 @@ void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t TEXT_SENSOR_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo TEXT_SENSOR_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(TextSensorStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(TextSensorStateResponse, state), 2, PROTO_FIELD_STRING, nullptr},
+    {offsetof(TextSensorStateResponse, missing_state), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable TextSensorStateResponse::get_field_table() const {
+  return {TEXT_SENSOR_STATE_RESPONSE_FIELDS, 3, TEXT_SENSOR_STATE_RESPONSE_INDEX, 4};
+}
+#else
 bool TextSensorStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 3: {
@@ -2537,6 +2968,7 @@ void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void TextSensorStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2556,6 +2988,17 @@ void TextSensorStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SUBSCRIBE_LOGS_REQUEST_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo SUBSCRIBE_LOGS_REQUEST_FIELDS[] = {
+    {offsetof(SubscribeLogsRequest, level), 1, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(SubscribeLogsRequest, dump_config), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(SubscribeLogsRequest, binary), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable SubscribeLogsRequest::get_field_table() const {
+  return {SUBSCRIBE_LOGS_REQUEST_FIELDS, 3, SUBSCRIBE_LOGS_REQUEST_INDEX, 4};
+}
+#else
 bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -2566,6 +3009,10 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
       this->dump_config = value.as_bool();
       return true;
     }
+    case 3: {
+      this->binary = value.as_bool();
+      return true;
+    }
     default:
       return false;
   }
@@ -2573,7 +3020,9 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 void SubscribeLogsRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LogLevel>(1, this->level);
   buffer.encode_bool(2, this->dump_config);
+  buffer.encode_bool(3, this->binary);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeLogsRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2585,9 +3034,24 @@ void SubscribeLogsRequest::dump_to(std::string &out) const {
   out.append("  dump_config: ");
   out.append(YESNO(this->dump_config));
   out.append("\n");
+
+  out.append("  binary: ");
+  out.append(YESNO(this->binary));
+  out.append("\n");
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SUBSCRIBE_LOGS_RESPONSE_INDEX[] = {0, 1, 0, 2, 3};
+static const ProtoFieldInfo SUBSCRIBE_LOGS_RESPONSE_FIELDS[] = {
+    {offsetof(SubscribeLogsResponse, level), 1, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(SubscribeLogsResponse, message), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(SubscribeLogsResponse, send_failed), 4, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable SubscribeLogsResponse::get_field_table() const {
+  return {SUBSCRIBE_LOGS_RESPONSE_FIELDS, 3, SUBSCRIBE_LOGS_RESPONSE_INDEX, 5};
+}
+#else
 bool SubscribeLogsResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -2617,6 +3081,7 @@ void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->message);
   buffer.encode_bool(4, this->send_failed);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeLogsResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2635,12 +3100,169 @@ void SubscribeLogsResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SUBSCRIBE_LOGS_STRING_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo SUBSCRIBE_LOGS_STRING_RESPONSE_FIELDS[] = {
+    {offsetof(SubscribeLogsStringResponse, id), 1, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(SubscribeLogsStringResponse, value), 2, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable SubscribeLogsStringResponse::get_field_table() const {
+  return {SUBSCRIBE_LOGS_STRING_RESPONSE_FIELDS, 2, SUBSCRIBE_LOGS_STRING_RESPONSE_INDEX, 3};
+}
+#else
+bool SubscribeLogsStringResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->id = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool SubscribeLogsStringResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 2: {
+      this->value = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeLogsStringResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, this->id);
+  buffer.encode_string(2, this->value);
+}
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void SubscribeLogsStringResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeLogsStringResponse {\n");
+  out.append("  id: ");
+  sprintf(buffer, "%u", this->id);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  value: ");
+  out.append("'").append(this->value).append("'");
+  out.append("\n");
+  out.append("}");
+}
+#endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SUBSCRIBE_LOGS_BINARY_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6};
+static const ProtoFieldInfo SUBSCRIBE_LOGS_BINARY_RESPONSE_FIELDS[] = {
+    {offsetof(SubscribeLogsBinaryResponse, level), 1, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(SubscribeLogsBinaryResponse, tag_id), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(SubscribeLogsBinaryResponse, format_id), 3, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(SubscribeLogsBinaryResponse, line), 4, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(SubscribeLogsBinaryResponse, timestamp), 5, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(SubscribeLogsBinaryResponse, args), 6, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable SubscribeLogsBinaryResponse::get_field_table() const {
+  return {SUBSCRIBE_LOGS_BINARY_RESPONSE_FIELDS, 6, SUBSCRIBE_LOGS_BINARY_RESPONSE_INDEX, 7};
+}
+#else
+bool SubscribeLogsBinaryResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->level = value.as_enum<enums::LogLevel>();
+      return true;
+    }
+    case 2: {
+      this->tag_id = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->format_id = value.as_uint32();
+      return true;
+    }
+    case 4: {
+      this->line = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->timestamp = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool SubscribeLogsBinaryResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 6: {
+      this->args = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeLogsBinaryResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_enum<enums::LogLevel>(1, this->level);
+  buffer.encode_uint32(2, this->tag_id);
+  buffer.encode_uint32(3, this->format_id);
+  buffer.encode_uint32(4, this->line);
+  buffer.encode_uint32(5, this->timestamp);
+  buffer.encode_string(6, this->args);
+}
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void SubscribeLogsBinaryResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeLogsBinaryResponse {\n");
+  out.append("  level: ");
+  out.append(proto_enum_to_string<enums::LogLevel>(this->level));
+  out.append("\n");
+
+  out.append("  tag_id: ");
+  sprintf(buffer, "%u", this->tag_id);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  format_id: ");
+  sprintf(buffer, "%u", this->format_id);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  line: ");
+  sprintf(buffer, "%u", this->line);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  timestamp: ");
+  sprintf(buffer, "%u", this->timestamp);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  args: ");
+  out.append("'").append(this->args).append("'");
+  out.append("\n");
+  out.append("}");
+}
+#endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable SubscribeHomeassistantServicesRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeassistantServicesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeassistantServicesRequest {}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t HOMEASSISTANT_SERVICE_MAP_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo HOMEASSISTANT_SERVICE_MAP_FIELDS[] = {
+    {offsetof(HomeassistantServiceMap, key), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(HomeassistantServiceMap, value), 2, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable HomeassistantServiceMap::get_field_table() const {
+  return {HOMEASSISTANT_SERVICE_MAP_FIELDS, 2, HOMEASSISTANT_SERVICE_MAP_INDEX, 3};
+}
+#else
 bool HomeassistantServiceMap::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
@@ -2659,6 +3281,7 @@ void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->key);
   buffer.encode_string(2, this->value);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeassistantServiceMap::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2673,6 +3296,22 @@ void HomeassistantServiceMap::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t HOMEASSISTANT_SERVICE_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5};
+static const ProtoFieldInfo HOMEASSISTANT_SERVICE_RESPONSE_FIELDS[] = {
+    {offsetof(HomeassistantServiceResponse, service), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(HomeassistantServiceResponse, data), 2, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<HomeassistantServiceMap>::OPS},
+    {offsetof(HomeassistantServiceResponse, data_template), 3, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<HomeassistantServiceMap>::OPS},
+    {offsetof(HomeassistantServiceResponse, variables), 4, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<HomeassistantServiceMap>::OPS},
+    {offsetof(HomeassistantServiceResponse, is_event), 5, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable HomeassistantServiceResponse::get_field_table() const {
+  return {HOMEASSISTANT_SERVICE_RESPONSE_FIELDS, 5, HOMEASSISTANT_SERVICE_RESPONSE_INDEX, 6};
+}
+#else
 bool HomeassistantServiceResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 5: {
@@ -2718,6 +3357,7 @@ void HomeassistantServiceResponse::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_bool(5, this->is_event);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeassistantServiceResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2750,12 +3390,26 @@ void HomeassistantServiceResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable SubscribeHomeAssistantStatesRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeAssistantStatesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeAssistantStatesRequest {}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(SubscribeHomeAssistantStateResponse, entity_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(SubscribeHomeAssistantStateResponse, attribute), 2, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable SubscribeHomeAssistantStateResponse::get_field_table() const {
+  return {SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_FIELDS, 2, SUBSCRIBE_HOME_ASSISTANT_STATE_RESPONSE_INDEX, 3};
+}
+#else
 bool SubscribeHomeAssistantStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
@@ -2774,6 +3428,7 @@ void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const
   buffer.encode_string(1, this->entity_id);
   buffer.encode_string(2, this->attribute);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2788,6 +3443,17 @@ void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t HOME_ASSISTANT_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo HOME_ASSISTANT_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(HomeAssistantStateResponse, entity_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(HomeAssistantStateResponse, state), 2, PROTO_FIELD_STRING, nullptr},
+    {offsetof(HomeAssistantStateResponse, attribute), 3, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable HomeAssistantStateResponse::get_field_table() const {
+  return {HOME_ASSISTANT_STATE_RESPONSE_FIELDS, 3, HOME_ASSISTANT_STATE_RESPONSE_INDEX, 4};
+}
+#else
 bool HomeAssistantStateResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
@@ -2811,6 +3477,7 @@ void HomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_string(3, this->attribute);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void HomeAssistantStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2829,10 +3496,23 @@ void HomeAssistantStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable GetTimeRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void GetTimeRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t GET_TIME_RESPONSE_INDEX[] = {0, 1};
+static const ProtoFieldInfo GET_TIME_RESPONSE_FIELDS[] = {
+    {offsetof(GetTimeResponse, epoch_seconds), 1, PROTO_FIELD_FIXED32, nullptr},
+};
+ProtoFieldTable GetTimeResponse::get_field_table() const {
+  return {GET_TIME_RESPONSE_FIELDS, 1, GET_TIME_RESPONSE_INDEX, 2};
+}
+#else
 bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   switch (field_id) {
     case 1: {
@@ -2844,6 +3524,7 @@ bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   }
 }
 void GetTimeResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->epoch_seconds); }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void GetTimeResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2855,6 +3536,16 @@ void GetTimeResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_SERVICES_ARGUMENT_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo LIST_ENTITIES_SERVICES_ARGUMENT_FIELDS[] = {
+    {offsetof(ListEntitiesServicesArgument, name), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesServicesArgument, type), 2, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesServicesArgument::get_field_table() const {
+  return {LIST_ENTITIES_SERVICES_ARGUMENT_FIELDS, 2, LIST_ENTITIES_SERVICES_ARGUMENT_INDEX, 3};
+}
+#else
 bool ListEntitiesServicesArgument::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -2879,6 +3570,7 @@ void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->name);
   buffer.encode_enum<enums::ServiceArgType>(2, this->type);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesServicesArgument::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2893,6 +3585,18 @@ void ListEntitiesServicesArgument::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_SERVICES_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo LIST_ENTITIES_SERVICES_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesServicesResponse, name), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesServicesResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesServicesResponse, args), 3, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<ListEntitiesServicesArgument>::OPS},
+};
+ProtoFieldTable ListEntitiesServicesResponse::get_field_table() const {
+  return {LIST_ENTITIES_SERVICES_RESPONSE_FIELDS, 3, LIST_ENTITIES_SERVICES_RESPONSE_INDEX, 4};
+}
+#else
 bool ListEntitiesServicesResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 1: {
@@ -2924,6 +3628,7 @@ void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ListEntitiesServicesArgument>(3, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesServicesResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -2945,6 +3650,23 @@ void ListEntitiesServicesResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t EXECUTE_SERVICE_ARGUMENT_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+static const ProtoFieldInfo EXECUTE_SERVICE_ARGUMENT_FIELDS[] = {
+    {offsetof(ExecuteServiceArgument, bool_), 1, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ExecuteServiceArgument, legacy_int), 2, PROTO_FIELD_INT32, nullptr},
+    {offsetof(ExecuteServiceArgument, float_), 3, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ExecuteServiceArgument, string_), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ExecuteServiceArgument, int_), 5, PROTO_FIELD_SINT32, nullptr},
+    {offsetof(ExecuteServiceArgument, bool_array), 6, PROTO_FIELD_REPEATED_BOOL, nullptr},
+    {offsetof(ExecuteServiceArgument, int_array), 7, PROTO_FIELD_SINT32, &ProtoRepeated<int32_t>::OPS},
+    {offsetof(ExecuteServiceArgument, float_array), 8, PROTO_FIELD_FLOAT, &ProtoRepeated<float>::OPS},
+    {offsetof(ExecuteServiceArgument, string_array), 9, PROTO_FIELD_STRING, &ProtoRepeated<std::string>::OPS},
+};
+ProtoFieldTable ExecuteServiceArgument::get_field_table() const {
+  return {EXECUTE_SERVICE_ARGUMENT_FIELDS, 9, EXECUTE_SERVICE_ARGUMENT_INDEX, 10};
+}
+#else
 bool ExecuteServiceArgument::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -3018,6 +3740,7 @@ void ExecuteServiceArgument::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_string(9, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ExecuteServiceArgument::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3073,6 +3796,16 @@ void ExecuteServiceArgument::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t EXECUTE_SERVICE_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo EXECUTE_SERVICE_REQUEST_FIELDS[] = {
+    {offsetof(ExecuteServiceRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ExecuteServiceRequest, args), 2, PROTO_FIELD_MESSAGE, &ProtoRepeated<ExecuteServiceArgument>::OPS},
+};
+ProtoFieldTable ExecuteServiceRequest::get_field_table() const {
+  return {EXECUTE_SERVICE_REQUEST_FIELDS, 2, EXECUTE_SERVICE_REQUEST_INDEX, 3};
+}
+#else
 bool ExecuteServiceRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 2: {
@@ -3099,6 +3832,7 @@ void ExecuteServiceRequest::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ExecuteServiceArgument>(2, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ExecuteServiceRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3116,6 +3850,21 @@ void ExecuteServiceRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_CAMERA_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7};
+static const ProtoFieldInfo LIST_ENTITIES_CAMERA_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesCameraResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCameraResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesCameraResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCameraResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCameraResponse, disabled_by_default), 5, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesCameraResponse, icon), 6, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesCameraResponse, entity_category), 7, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesCameraResponse::get_field_table() const {
+  return {LIST_ENTITIES_CAMERA_RESPONSE_FIELDS, 7, LIST_ENTITIES_CAMERA_RESPONSE_INDEX, 8};
+}
+#else
 bool ListEntitiesCameraResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 5: {
@@ -3171,6 +3920,7 @@ void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(6, this->icon);
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesCameraResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3206,6 +3956,17 @@ void ListEntitiesCameraResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t CAMERA_IMAGE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo CAMERA_IMAGE_RESPONSE_FIELDS[] = {
+    {offsetof(CameraImageResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(CameraImageResponse, data), 2, PROTO_FIELD_STRING, nullptr},
+    {offsetof(CameraImageResponse, done), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable CameraImageResponse::get_field_table() const {
+  return {CAMERA_IMAGE_RESPONSE_FIELDS, 3, CAMERA_IMAGE_RESPONSE_INDEX, 4};
+}
+#else
 bool CameraImageResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 3: {
@@ -3241,6 +4002,7 @@ void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->data);
   buffer.encode_bool(3, this->done);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CameraImageResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3260,6 +4022,16 @@ void CameraImageResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t CAMERA_IMAGE_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo CAMERA_IMAGE_REQUEST_FIELDS[] = {
+    {offsetof(CameraImageRequest, single), 1, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(CameraImageRequest, stream), 2, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable CameraImageRequest::get_field_table() const {
+  return {CAMERA_IMAGE_REQUEST_FIELDS, 2, CAMERA_IMAGE_REQUEST_INDEX, 3};
+}
+#else
 bool CameraImageRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -3278,6 +4050,7 @@ void CameraImageRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->single);
   buffer.encode_bool(2, this->stream);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void CameraImageRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3292,6 +4065,41 @@ void CameraImageRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_CLIMATE_RESPONSE_INDEX[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+static const ProtoFieldInfo LIST_ENTITIES_CLIMATE_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesClimateResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesClimateResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesClimateResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesClimateResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesClimateResponse, supports_current_temperature), 5, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesClimateResponse, supports_two_point_target_temperature), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesClimateResponse, supported_modes), 7, PROTO_FIELD_ENUM,
+     &ProtoRepeated<enums::ClimateMode>::OPS},
+    {offsetof(ListEntitiesClimateResponse, visual_min_temperature), 8, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesClimateResponse, visual_max_temperature), 9, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesClimateResponse, visual_temperature_step), 10, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesClimateResponse, legacy_supports_away), 11, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesClimateResponse, supports_action), 12, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesClimateResponse, supported_fan_modes), 13, PROTO_FIELD_ENUM,
+     &ProtoRepeated<enums::ClimateFanMode>::OPS},
+    {offsetof(ListEntitiesClimateResponse, supported_swing_modes), 14, PROTO_FIELD_ENUM,
+     &ProtoRepeated<enums::ClimateSwingMode>::OPS},
+    {offsetof(ListEntitiesClimateResponse, supported_custom_fan_modes), 15, PROTO_FIELD_STRING,
+     &ProtoRepeated<std::string>::OPS},
+    {offsetof(ListEntitiesClimateResponse, supported_presets), 16, PROTO_FIELD_ENUM,
+     &ProtoRepeated<enums::ClimatePreset>::OPS},
+    {offsetof(ListEntitiesClimateResponse, supported_custom_presets), 17, PROTO_FIELD_STRING,
+     &ProtoRepeated<std::string>::OPS},
+    {offsetof(ListEntitiesClimateResponse, disabled_by_default), 18, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesClimateResponse, icon), 19, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesClimateResponse, entity_category), 20, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesClimateResponse::get_field_table() const {
+  return {LIST_ENTITIES_CLIMATE_RESPONSE_FIELDS, 20, LIST_ENTITIES_CLIMATE_RESPONSE_INDEX, 21};
+}
+#else
 bool ListEntitiesClimateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 5: {
@@ -3424,6 +4232,7 @@ void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(19, this->icon);
   buffer.encode_enum<enums::EntityCategory>(20, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesClimateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3526,6 +4335,27 @@ void ListEntitiesClimateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t CLIMATE_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+static const ProtoFieldInfo CLIMATE_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(ClimateStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ClimateStateResponse, mode), 2, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateStateResponse, current_temperature), 3, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateStateResponse, target_temperature), 4, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateStateResponse, target_temperature_low), 5, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateStateResponse, target_temperature_high), 6, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateStateResponse, legacy_away), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateStateResponse, action), 8, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateStateResponse, fan_mode), 9, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateStateResponse, swing_mode), 10, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateStateResponse, custom_fan_mode), 11, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ClimateStateResponse, preset), 12, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateStateResponse, custom_preset), 13, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable ClimateStateResponse::get_field_table() const {
+  return {CLIMATE_STATE_RESPONSE_FIELDS, 13, CLIMATE_STATE_RESPONSE_INDEX, 14};
+}
+#else
 bool ClimateStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -3611,6 +4441,7 @@ void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::ClimatePreset>(12, this->preset);
   buffer.encode_string(13, this->custom_preset);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ClimateStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3674,6 +4505,36 @@ void ClimateStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t CLIMATE_COMMAND_REQUEST_INDEX[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21};
+static const ProtoFieldInfo CLIMATE_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(ClimateCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ClimateCommandRequest, has_mode), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, mode), 3, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateCommandRequest, has_target_temperature), 4, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, target_temperature), 5, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateCommandRequest, has_target_temperature_low), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, target_temperature_low), 7, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateCommandRequest, has_target_temperature_high), 8, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, target_temperature_high), 9, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ClimateCommandRequest, has_legacy_away), 10, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, legacy_away), 11, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, has_fan_mode), 12, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, fan_mode), 13, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateCommandRequest, has_swing_mode), 14, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, swing_mode), 15, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateCommandRequest, has_custom_fan_mode), 16, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, custom_fan_mode), 17, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ClimateCommandRequest, has_preset), 18, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, preset), 19, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ClimateCommandRequest, has_custom_preset), 20, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ClimateCommandRequest, custom_preset), 21, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable ClimateCommandRequest::get_field_table() const {
+  return {CLIMATE_COMMAND_REQUEST_FIELDS, 21, CLIMATE_COMMAND_REQUEST_INDEX, 22};
+}
+#else
 bool ClimateCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -3799,6 +4660,7 @@ void ClimateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(20, this->has_custom_preset);
   buffer.encode_string(21, this->custom_preset);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ClimateCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -3893,6 +4755,26 @@ void ClimateCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_NUMBER_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+static const ProtoFieldInfo LIST_ENTITIES_NUMBER_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesNumberResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesNumberResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesNumberResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesNumberResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesNumberResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesNumberResponse, min_value), 6, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesNumberResponse, max_value), 7, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesNumberResponse, step), 8, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(ListEntitiesNumberResponse, disabled_by_default), 9, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesNumberResponse, entity_category), 10, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesNumberResponse, unit_of_measurement), 11, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesNumberResponse, mode), 12, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesNumberResponse::get_field_table() const {
+  return {LIST_ENTITIES_NUMBER_RESPONSE_FIELDS, 12, LIST_ENTITIES_NUMBER_RESPONSE_INDEX, 13};
+}
+#else
 bool ListEntitiesNumberResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 9: {
@@ -3973,6 +4855,7 @@ void ListEntitiesNumberResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(11, this->unit_of_measurement);
   buffer.encode_enum<enums::NumberMode>(12, this->mode);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesNumberResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4031,6 +4914,17 @@ void ListEntitiesNumberResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t NUMBER_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo NUMBER_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(NumberStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(NumberStateResponse, state), 2, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(NumberStateResponse, missing_state), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable NumberStateResponse::get_field_table() const {
+  return {NUMBER_STATE_RESPONSE_FIELDS, 3, NUMBER_STATE_RESPONSE_INDEX, 4};
+}
+#else
 bool NumberStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 3: {
@@ -4060,6 +4954,7 @@ void NumberStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void NumberStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4080,6 +4975,16 @@ void NumberStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t NUMBER_COMMAND_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo NUMBER_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(NumberCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(NumberCommandRequest, state), 2, PROTO_FIELD_FLOAT, nullptr},
+};
+ProtoFieldTable NumberCommandRequest::get_field_table() const {
+  return {NUMBER_COMMAND_REQUEST_FIELDS, 2, NUMBER_COMMAND_REQUEST_INDEX, 3};
+}
+#else
 bool NumberCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
   switch (field_id) {
     case 1: {
@@ -4098,6 +5003,7 @@ void NumberCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_float(2, this->state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void NumberCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4114,6 +5020,22 @@ void NumberCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_SELECT_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const ProtoFieldInfo LIST_ENTITIES_SELECT_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesSelectResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSelectResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesSelectResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSelectResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSelectResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesSelectResponse, options), 6, PROTO_FIELD_STRING, &ProtoRepeated<std::string>::OPS},
+    {offsetof(ListEntitiesSelectResponse, disabled_by_default), 7, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesSelectResponse, entity_category), 8, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable ListEntitiesSelectResponse::get_field_table() const {
+  return {LIST_ENTITIES_SELECT_RESPONSE_FIELDS, 8, LIST_ENTITIES_SELECT_RESPONSE_INDEX, 9};
+}
+#else
 bool ListEntitiesSelectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 7: {
@@ -4176,6 +5098,7 @@ void ListEntitiesSelectResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->disabled_by_default);
   buffer.encode_enum<enums::EntityCategory>(8, this->entity_category);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesSelectResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4217,6 +5140,17 @@ void ListEntitiesSelectResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SELECT_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo SELECT_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(SelectStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(SelectStateResponse, state), 2, PROTO_FIELD_STRING, nullptr},
+    {offsetof(SelectStateResponse, missing_state), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable SelectStateResponse::get_field_table() const {
+  return {SELECT_STATE_RESPONSE_FIELDS, 3, SELECT_STATE_RESPONSE_INDEX, 4};
+}
+#else
 bool SelectStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 3: {
@@ -4252,6 +5186,7 @@ void SelectStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SelectStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4271,6 +5206,16 @@ void SelectStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SELECT_COMMAND_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo SELECT_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(SelectCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(SelectCommandRequest, state), 2, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable SelectCommandRequest::get_field_table() const {
+  return {SELECT_COMMAND_REQUEST_FIELDS, 2, SELECT_COMMAND_REQUEST_INDEX, 3};
+}
+#else
 bool SelectCommandRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
   switch (field_id) {
     case 2: {
@@ -4295,6 +5240,7 @@ void SelectCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_string(2, this->state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SelectCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4310,6 +5256,25 @@ void SelectCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_LOCK_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const ProtoFieldInfo LIST_ENTITIES_LOCK_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesLockResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLockResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesLockResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLockResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLockResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesLockResponse, disabled_by_default), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLockResponse, entity_category), 7, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesLockResponse, assumed_state), 8, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLockResponse, supports_open), 9, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLockResponse, requires_code), 10, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesLockResponse, code_format), 11, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable ListEntitiesLockResponse::get_field_table() const {
+  return {LIST_ENTITIES_LOCK_RESPONSE_FIELDS, 11, LIST_ENTITIES_LOCK_RESPONSE_INDEX, 12};
+}
+#else
 bool ListEntitiesLockResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -4385,6 +5350,7 @@ void ListEntitiesLockResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(10, this->requires_code);
   buffer.encode_string(11, this->code_format);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesLockResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4436,6 +5402,16 @@ void ListEntitiesLockResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LOCK_STATE_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo LOCK_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(LockStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(LockStateResponse, state), 2, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable LockStateResponse::get_field_table() const {
+  return {LOCK_STATE_RESPONSE_FIELDS, 2, LOCK_STATE_RESPONSE_INDEX, 3};
+}
+#else
 bool LockStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -4460,6 +5436,7 @@ void LockStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_enum<enums::LockState>(2, this->state);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LockStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4475,6 +5452,18 @@ void LockStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LOCK_COMMAND_REQUEST_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo LOCK_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(LockCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(LockCommandRequest, command), 2, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(LockCommandRequest, has_code), 3, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(LockCommandRequest, code), 4, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable LockCommandRequest::get_field_table() const {
+  return {LOCK_COMMAND_REQUEST_FIELDS, 4, LOCK_COMMAND_REQUEST_INDEX, 5};
+}
+#else
 bool LockCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -4515,6 +5504,7 @@ void LockCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(3, this->has_code);
   buffer.encode_string(4, this->code);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LockCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4538,6 +5528,22 @@ void LockCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_BUTTON_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const ProtoFieldInfo LIST_ENTITIES_BUTTON_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesButtonResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesButtonResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesButtonResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesButtonResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesButtonResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesButtonResponse, disabled_by_default), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesButtonResponse, entity_category), 7, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesButtonResponse, device_class), 8, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable ListEntitiesButtonResponse::get_field_table() const {
+  return {LIST_ENTITIES_BUTTON_RESPONSE_FIELDS, 8, LIST_ENTITIES_BUTTON_RESPONSE_INDEX, 9};
+}
+#else
 bool ListEntitiesButtonResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -4598,6 +5604,7 @@ void ListEntitiesButtonResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_string(8, this->device_class);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesButtonResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4637,6 +5644,15 @@ void ListEntitiesButtonResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BUTTON_COMMAND_REQUEST_INDEX[] = {0, 1};
+static const ProtoFieldInfo BUTTON_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(ButtonCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+};
+ProtoFieldTable ButtonCommandRequest::get_field_table() const {
+  return {BUTTON_COMMAND_REQUEST_FIELDS, 1, BUTTON_COMMAND_REQUEST_INDEX, 2};
+}
+#else
 bool ButtonCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
   switch (field_id) {
     case 1: {
@@ -4648,6 +5664,7 @@ bool ButtonCommandRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
   }
 }
 void ButtonCommandRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->key); }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ButtonCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4659,6 +5676,22 @@ void ButtonCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const ProtoFieldInfo LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_FIELDS[] = {
+    {offsetof(ListEntitiesMediaPlayerResponse, object_id), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, key), 2, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, name), 3, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, unique_id), 4, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, icon), 5, PROTO_FIELD_STRING, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, disabled_by_default), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, entity_category), 7, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(ListEntitiesMediaPlayerResponse, supports_pause), 8, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable ListEntitiesMediaPlayerResponse::get_field_table() const {
+  return {LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_FIELDS, 8, LIST_ENTITIES_MEDIA_PLAYER_RESPONSE_INDEX, 9};
+}
+#else
 bool ListEntitiesMediaPlayerResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -4719,6 +5752,7 @@ void ListEntitiesMediaPlayerResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::EntityCategory>(7, this->entity_category);
   buffer.encode_bool(8, this->supports_pause);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void ListEntitiesMediaPlayerResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4758,6 +5792,18 @@ void ListEntitiesMediaPlayerResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t MEDIA_PLAYER_STATE_RESPONSE_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo MEDIA_PLAYER_STATE_RESPONSE_FIELDS[] = {
+    {offsetof(MediaPlayerStateResponse, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(MediaPlayerStateResponse, state), 2, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(MediaPlayerStateResponse, volume), 3, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(MediaPlayerStateResponse, muted), 4, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable MediaPlayerStateResponse::get_field_table() const {
+  return {MEDIA_PLAYER_STATE_RESPONSE_FIELDS, 4, MEDIA_PLAYER_STATE_RESPONSE_INDEX, 5};
+}
+#else
 bool MediaPlayerStateResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -4792,6 +5838,7 @@ void MediaPlayerStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(3, this->volume);
   buffer.encode_bool(4, this->muted);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerStateResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4816,6 +5863,21 @@ void MediaPlayerStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t MEDIA_PLAYER_COMMAND_REQUEST_INDEX[] = {0, 1, 2, 3, 4, 5, 6, 7};
+static const ProtoFieldInfo MEDIA_PLAYER_COMMAND_REQUEST_FIELDS[] = {
+    {offsetof(MediaPlayerCommandRequest, key), 1, PROTO_FIELD_FIXED32, nullptr},
+    {offsetof(MediaPlayerCommandRequest, has_command), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(MediaPlayerCommandRequest, command), 3, PROTO_FIELD_ENUM, nullptr},
+    {offsetof(MediaPlayerCommandRequest, has_volume), 4, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(MediaPlayerCommandRequest, volume), 5, PROTO_FIELD_FLOAT, nullptr},
+    {offsetof(MediaPlayerCommandRequest, has_media_url), 6, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(MediaPlayerCommandRequest, media_url), 7, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable MediaPlayerCommandRequest::get_field_table() const {
+  return {MEDIA_PLAYER_COMMAND_REQUEST_FIELDS, 7, MEDIA_PLAYER_COMMAND_REQUEST_INDEX, 8};
+}
+#else
 bool MediaPlayerCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -4871,6 +5933,7 @@ void MediaPlayerCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->has_media_url);
   buffer.encode_string(7, this->media_url);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void MediaPlayerCommandRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4907,12 +5970,52 @@ void MediaPlayerCommandRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
-void SubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const {}
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_INDEX[] = {0, 1};
+static const ProtoFieldInfo SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_FIELDS[] = {
+    {offsetof(SubscribeBluetoothLEAdvertisementsRequest, flags), 1, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable SubscribeBluetoothLEAdvertisementsRequest::get_field_table() const {
+  return {SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_FIELDS, 1, SUBSCRIBE_BLUETOOTH_LE_ADVERTISEMENTS_REQUEST_INDEX,
+          2};
+}
+#else
+bool SubscribeBluetoothLEAdvertisementsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->flags = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeBluetoothLEAdvertisementsRequest::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, this->flags);
+}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeBluetoothLEAdvertisementsRequest::dump_to(std::string &out) const {
-  out.append("SubscribeBluetoothLEAdvertisementsRequest {}");
+  __attribute__((unused)) char buffer[64];
+  out.append("SubscribeBluetoothLEAdvertisementsRequest {\n");
+  out.append("  flags: ");
+  sprintf(buffer, "%u", this->flags);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_SERVICE_DATA_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_SERVICE_DATA_FIELDS[] = {
+    {offsetof(BluetoothServiceData, uuid), 1, PROTO_FIELD_STRING, nullptr},
+    {offsetof(BluetoothServiceData, legacy_data), 2, PROTO_FIELD_UINT32, &ProtoRepeated<uint32_t>::OPS},
+    {offsetof(BluetoothServiceData, data), 3, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable BluetoothServiceData::get_field_table() const {
+  return {BLUETOOTH_SERVICE_DATA_FIELDS, 3, BLUETOOTH_SERVICE_DATA_INDEX, 4};
+}
+#else
 bool BluetoothServiceData::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 2: {
@@ -4944,6 +6047,7 @@ void BluetoothServiceData::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_string(3, this->data);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothServiceData::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -4965,6 +6069,23 @@ void BluetoothServiceData::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_INDEX[] = {0, 1, 2, 3, 4, 5, 6};
+static const ProtoFieldInfo BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothLEAdvertisementResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothLEAdvertisementResponse, name), 2, PROTO_FIELD_STRING, nullptr},
+    {offsetof(BluetoothLEAdvertisementResponse, rssi), 3, PROTO_FIELD_SINT32, nullptr},
+    {offsetof(BluetoothLEAdvertisementResponse, service_uuids), 4, PROTO_FIELD_STRING,
+     &ProtoRepeated<std::string>::OPS},
+    {offsetof(BluetoothLEAdvertisementResponse, service_data), 5, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<BluetoothServiceData>::OPS},
+    {offsetof(BluetoothLEAdvertisementResponse, manufacturer_data), 6, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<BluetoothServiceData>::OPS},
+};
+ProtoFieldTable BluetoothLEAdvertisementResponse::get_field_table() const {
+  return {BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_FIELDS, 6, BLUETOOTH_LE_ADVERTISEMENT_RESPONSE_INDEX, 7};
+}
+#else
 bool BluetoothLEAdvertisementResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5015,6 +6136,7 @@ void BluetoothLEAdvertisementResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<BluetoothServiceData>(6, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothLEAdvertisementResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5053,6 +6175,126 @@ void BluetoothLEAdvertisementResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_LE_RAW_ADVERTISEMENT_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo BLUETOOTH_LE_RAW_ADVERTISEMENT_FIELDS[] = {
+    {offsetof(BluetoothLERawAdvertisement, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothLERawAdvertisement, rssi), 2, PROTO_FIELD_SINT32, nullptr},
+    {offsetof(BluetoothLERawAdvertisement, address_type), 3, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothLERawAdvertisement, data), 4, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable BluetoothLERawAdvertisement::get_field_table() const {
+  return {BLUETOOTH_LE_RAW_ADVERTISEMENT_FIELDS, 4, BLUETOOTH_LE_RAW_ADVERTISEMENT_INDEX, 5};
+}
+#else
+bool BluetoothLERawAdvertisement::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->address = value.as_uint64();
+      return true;
+    }
+    case 2: {
+      this->rssi = value.as_sint32();
+      return true;
+    }
+    case 3: {
+      this->address_type = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool BluetoothLERawAdvertisement::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 4: {
+      this->data = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void BluetoothLERawAdvertisement::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint64(1, this->address);
+  buffer.encode_sint32(2, this->rssi);
+  buffer.encode_uint32(3, this->address_type);
+  buffer.encode_string(4, this->data);
+}
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void BluetoothLERawAdvertisement::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("BluetoothLERawAdvertisement {\n");
+  out.append("  address: ");
+  sprintf(buffer, "%llu", this->address);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  rssi: ");
+  sprintf(buffer, "%d", this->rssi);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  address_type: ");
+  sprintf(buffer, "%u", this->address_type);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  data: ");
+  out.append("'").append(this->data).append("'");
+  out.append("\n");
+  out.append("}");
+}
+#endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_INDEX[] = {0, 1};
+static const ProtoFieldInfo BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothLERawAdvertisementsResponse, advertisements), 1, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<BluetoothLERawAdvertisement>::OPS},
+};
+ProtoFieldTable BluetoothLERawAdvertisementsResponse::get_field_table() const {
+  return {BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_FIELDS, 1, BLUETOOTH_LE_RAW_ADVERTISEMENTS_RESPONSE_INDEX, 2};
+}
+#else
+bool BluetoothLERawAdvertisementsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->advertisements.push_back(value.as_message<BluetoothLERawAdvertisement>());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void BluetoothLERawAdvertisementsResponse::encode(ProtoWriteBuffer buffer) const {
+  for (auto &it : this->advertisements) {
+    buffer.encode_message<BluetoothLERawAdvertisement>(1, it, true);
+  }
+}
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void BluetoothLERawAdvertisementsResponse::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("BluetoothLERawAdvertisementsResponse {\n");
+  for (const auto &it : this->advertisements) {
+    out.append("  advertisements: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+  out.append("}");
+}
+#endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_DEVICE_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_DEVICE_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothDeviceRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothDeviceRequest, request_type), 2, PROTO_FIELD_ENUM, nullptr},
+};
+ProtoFieldTable BluetoothDeviceRequest::get_field_table() const {
+  return {BLUETOOTH_DEVICE_REQUEST_FIELDS, 2, BLUETOOTH_DEVICE_REQUEST_INDEX, 3};
+}
+#else
 bool BluetoothDeviceRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5071,6 +6313,7 @@ void BluetoothDeviceRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_enum<enums::BluetoothDeviceRequestType>(2, this->request_type);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDeviceRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5086,6 +6329,18 @@ void BluetoothDeviceRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_DEVICE_CONNECTION_RESPONSE_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo BLUETOOTH_DEVICE_CONNECTION_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothDeviceConnectionResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothDeviceConnectionResponse, connected), 2, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(BluetoothDeviceConnectionResponse, mtu), 3, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothDeviceConnectionResponse, error), 4, PROTO_FIELD_INT32, nullptr},
+};
+ProtoFieldTable BluetoothDeviceConnectionResponse::get_field_table() const {
+  return {BLUETOOTH_DEVICE_CONNECTION_RESPONSE_FIELDS, 4, BLUETOOTH_DEVICE_CONNECTION_RESPONSE_INDEX, 5};
+}
+#else
 bool BluetoothDeviceConnectionResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5114,6 +6369,7 @@ void BluetoothDeviceConnectionResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(3, this->mtu);
   buffer.encode_int32(4, this->error);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothDeviceConnectionResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5139,6 +6395,15 @@ void BluetoothDeviceConnectionResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_GET_SERVICES_REQUEST_INDEX[] = {0, 1};
+static const ProtoFieldInfo BLUETOOTH_GATT_GET_SERVICES_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothGATTGetServicesRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+};
+ProtoFieldTable BluetoothGATTGetServicesRequest::get_field_table() const {
+  return {BLUETOOTH_GATT_GET_SERVICES_REQUEST_FIELDS, 1, BLUETOOTH_GATT_GET_SERVICES_REQUEST_INDEX, 2};
+}
+#else
 bool BluetoothGATTGetServicesRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5150,6 +6415,7 @@ bool BluetoothGATTGetServicesRequest::decode_varint(uint32_t field_id, ProtoVarI
   }
 }
 void BluetoothGATTGetServicesRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_uint64(1, this->address); }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTGetServicesRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5161,6 +6427,16 @@ void BluetoothGATTGetServicesRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_DESCRIPTOR_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_GATT_DESCRIPTOR_FIELDS[] = {
+    {offsetof(BluetoothGATTDescriptor, uuid), 1, PROTO_FIELD_UINT64, &ProtoRepeated<uint64_t>::OPS},
+    {offsetof(BluetoothGATTDescriptor, handle), 2, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable BluetoothGATTDescriptor::get_field_table() const {
+  return {BLUETOOTH_GATT_DESCRIPTOR_FIELDS, 2, BLUETOOTH_GATT_DESCRIPTOR_INDEX, 3};
+}
+#else
 bool BluetoothGATTDescriptor::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5181,6 +6457,7 @@ void BluetoothGATTDescriptor::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_uint32(2, this->handle);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTDescriptor::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5199,6 +6476,19 @@ void BluetoothGATTDescriptor::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_CHARACTERISTIC_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo BLUETOOTH_GATT_CHARACTERISTIC_FIELDS[] = {
+    {offsetof(BluetoothGATTCharacteristic, uuid), 1, PROTO_FIELD_UINT64, &ProtoRepeated<uint64_t>::OPS},
+    {offsetof(BluetoothGATTCharacteristic, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTCharacteristic, properties), 3, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTCharacteristic, descriptors), 4, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<BluetoothGATTDescriptor>::OPS},
+};
+ProtoFieldTable BluetoothGATTCharacteristic::get_field_table() const {
+  return {BLUETOOTH_GATT_CHARACTERISTIC_FIELDS, 4, BLUETOOTH_GATT_CHARACTERISTIC_INDEX, 5};
+}
+#else
 bool BluetoothGATTCharacteristic::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5237,6 +6527,7 @@ void BluetoothGATTCharacteristic::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<BluetoothGATTDescriptor>(4, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTCharacteristic::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5266,6 +6557,18 @@ void BluetoothGATTCharacteristic::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_SERVICE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_GATT_SERVICE_FIELDS[] = {
+    {offsetof(BluetoothGATTService, uuid), 1, PROTO_FIELD_UINT64, &ProtoRepeated<uint64_t>::OPS},
+    {offsetof(BluetoothGATTService, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTService, characteristics), 3, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<BluetoothGATTCharacteristic>::OPS},
+};
+ProtoFieldTable BluetoothGATTService::get_field_table() const {
+  return {BLUETOOTH_GATT_SERVICE_FIELDS, 3, BLUETOOTH_GATT_SERVICE_INDEX, 4};
+}
+#else
 bool BluetoothGATTService::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5299,6 +6602,7 @@ void BluetoothGATTService::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<BluetoothGATTCharacteristic>(3, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTService::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5323,6 +6627,17 @@ void BluetoothGATTService::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_GET_SERVICES_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_GATT_GET_SERVICES_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTGetServicesResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTGetServicesResponse, services), 2, PROTO_FIELD_MESSAGE,
+     &ProtoRepeated<BluetoothGATTService>::OPS},
+};
+ProtoFieldTable BluetoothGATTGetServicesResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_GET_SERVICES_RESPONSE_FIELDS, 2, BLUETOOTH_GATT_GET_SERVICES_RESPONSE_INDEX, 3};
+}
+#else
 bool BluetoothGATTGetServicesResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5349,6 +6664,7 @@ void BluetoothGATTGetServicesResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<BluetoothGATTService>(2, it, true);
   }
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTGetServicesResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5366,6 +6682,15 @@ void BluetoothGATTGetServicesResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_INDEX[] = {0, 1};
+static const ProtoFieldInfo BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTGetServicesDoneResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+};
+ProtoFieldTable BluetoothGATTGetServicesDoneResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_FIELDS, 1, BLUETOOTH_GATT_GET_SERVICES_DONE_RESPONSE_INDEX, 2};
+}
+#else
 bool BluetoothGATTGetServicesDoneResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5379,6 +6704,7 @@ bool BluetoothGATTGetServicesDoneResponse::decode_varint(uint32_t field_id, Prot
 void BluetoothGATTGetServicesDoneResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTGetServicesDoneResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5390,6 +6716,16 @@ void BluetoothGATTGetServicesDoneResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_READ_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_GATT_READ_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothGATTReadRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTReadRequest, handle), 2, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable BluetoothGATTReadRequest::get_field_table() const {
+  return {BLUETOOTH_GATT_READ_REQUEST_FIELDS, 2, BLUETOOTH_GATT_READ_REQUEST_INDEX, 3};
+}
+#else
 bool BluetoothGATTReadRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5408,6 +6744,7 @@ void BluetoothGATTReadRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTReadRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5424,6 +6761,17 @@ void BluetoothGATTReadRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_READ_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_GATT_READ_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTReadResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTReadResponse, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTReadResponse, data), 3, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable BluetoothGATTReadResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_READ_RESPONSE_FIELDS, 3, BLUETOOTH_GATT_READ_RESPONSE_INDEX, 4};
+}
+#else
 bool BluetoothGATTReadResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5453,6 +6801,7 @@ void BluetoothGATTReadResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->handle);
   buffer.encode_string(3, this->data);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTReadResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5473,6 +6822,18 @@ void BluetoothGATTReadResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_WRITE_REQUEST_INDEX[] = {0, 1, 2, 3, 4};
+static const ProtoFieldInfo BLUETOOTH_GATT_WRITE_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothGATTWriteRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTWriteRequest, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTWriteRequest, response), 3, PROTO_FIELD_BOOL, nullptr},
+    {offsetof(BluetoothGATTWriteRequest, data), 4, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable BluetoothGATTWriteRequest::get_field_table() const {
+  return {BLUETOOTH_GATT_WRITE_REQUEST_FIELDS, 4, BLUETOOTH_GATT_WRITE_REQUEST_INDEX, 5};
+}
+#else
 bool BluetoothGATTWriteRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5507,6 +6868,7 @@ void BluetoothGATTWriteRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(3, this->response);
   buffer.encode_string(4, this->data);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTWriteRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5531,6 +6893,16 @@ void BluetoothGATTWriteRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothGATTReadDescriptorRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTReadDescriptorRequest, handle), 2, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable BluetoothGATTReadDescriptorRequest::get_field_table() const {
+  return {BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_FIELDS, 2, BLUETOOTH_GATT_READ_DESCRIPTOR_REQUEST_INDEX, 3};
+}
+#else
 bool BluetoothGATTReadDescriptorRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5549,6 +6921,7 @@ void BluetoothGATTReadDescriptorRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTReadDescriptorRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5565,6 +6938,17 @@ void BluetoothGATTReadDescriptorRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothGATTWriteDescriptorRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTWriteDescriptorRequest, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTWriteDescriptorRequest, data), 3, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable BluetoothGATTWriteDescriptorRequest::get_field_table() const {
+  return {BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_FIELDS, 3, BLUETOOTH_GATT_WRITE_DESCRIPTOR_REQUEST_INDEX, 4};
+}
+#else
 bool BluetoothGATTWriteDescriptorRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5594,6 +6978,7 @@ void BluetoothGATTWriteDescriptorRequest::encode(ProtoWriteBuffer buffer) const
   buffer.encode_uint32(2, this->handle);
   buffer.encode_string(3, this->data);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTWriteDescriptorRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5614,6 +6999,17 @@ void BluetoothGATTWriteDescriptorRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_NOTIFY_REQUEST_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_GATT_NOTIFY_REQUEST_FIELDS[] = {
+    {offsetof(BluetoothGATTNotifyRequest, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTNotifyRequest, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTNotifyRequest, enable), 3, PROTO_FIELD_BOOL, nullptr},
+};
+ProtoFieldTable BluetoothGATTNotifyRequest::get_field_table() const {
+  return {BLUETOOTH_GATT_NOTIFY_REQUEST_FIELDS, 3, BLUETOOTH_GATT_NOTIFY_REQUEST_INDEX, 4};
+}
+#else
 bool BluetoothGATTNotifyRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5637,6 +7033,7 @@ void BluetoothGATTNotifyRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->handle);
   buffer.encode_bool(3, this->enable);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTNotifyRequest::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5657,6 +7054,17 @@ void BluetoothGATTNotifyRequest::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTNotifyDataResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTNotifyDataResponse, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTNotifyDataResponse, data), 3, PROTO_FIELD_STRING, nullptr},
+};
+ProtoFieldTable BluetoothGATTNotifyDataResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_FIELDS, 3, BLUETOOTH_GATT_NOTIFY_DATA_RESPONSE_INDEX, 4};
+}
+#else
 bool BluetoothGATTNotifyDataResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5686,6 +7094,7 @@ void BluetoothGATTNotifyDataResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->handle);
   buffer.encode_string(3, this->data);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTNotifyDataResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5706,12 +7115,26 @@ void BluetoothGATTNotifyDataResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+ProtoFieldTable SubscribeBluetoothConnectionsFreeRequest::get_field_table() const { return {nullptr, 0, nullptr, 0}; }
+#else
 void SubscribeBluetoothConnectionsFreeRequest::encode(ProtoWriteBuffer buffer) const {}
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void SubscribeBluetoothConnectionsFreeRequest::dump_to(std::string &out) const {
   out.append("SubscribeBluetoothConnectionsFreeRequest {}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_CONNECTIONS_FREE_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_CONNECTIONS_FREE_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothConnectionsFreeResponse, free), 1, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothConnectionsFreeResponse, limit), 2, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable BluetoothConnectionsFreeResponse::get_field_table() const {
+  return {BLUETOOTH_CONNECTIONS_FREE_RESPONSE_FIELDS, 2, BLUETOOTH_CONNECTIONS_FREE_RESPONSE_INDEX, 3};
+}
+#else
 bool BluetoothConnectionsFreeResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5730,6 +7153,7 @@ void BluetoothConnectionsFreeResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(1, this->free);
   buffer.encode_uint32(2, this->limit);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothConnectionsFreeResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5746,6 +7170,17 @@ void BluetoothConnectionsFreeResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_ERROR_RESPONSE_INDEX[] = {0, 1, 2, 3};
+static const ProtoFieldInfo BLUETOOTH_GATT_ERROR_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTErrorResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTErrorResponse, handle), 2, PROTO_FIELD_UINT32, nullptr},
+    {offsetof(BluetoothGATTErrorResponse, error), 3, PROTO_FIELD_INT32, nullptr},
+};
+ProtoFieldTable BluetoothGATTErrorResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_ERROR_RESPONSE_FIELDS, 3, BLUETOOTH_GATT_ERROR_RESPONSE_INDEX, 4};
+}
+#else
 bool BluetoothGATTErrorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5769,6 +7204,7 @@ void BluetoothGATTErrorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->handle);
   buffer.encode_int32(3, this->error);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTErrorResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5790,6 +7226,16 @@ void BluetoothGATTErrorResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_WRITE_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_GATT_WRITE_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTWriteResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTWriteResponse, handle), 2, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable BluetoothGATTWriteResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_WRITE_RESPONSE_FIELDS, 2, BLUETOOTH_GATT_WRITE_RESPONSE_INDEX, 3};
+}
+#else
 bool BluetoothGATTWriteResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5808,6 +7254,7 @@ void BluetoothGATTWriteResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTWriteResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
@@ -5824,6 +7271,16 @@ void BluetoothGATTWriteResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+#ifdef USE_API_PROTO_TABLES
+static const uint8_t BLUETOOTH_GATT_NOTIFY_RESPONSE_INDEX[] = {0, 1, 2};
+static const ProtoFieldInfo BLUETOOTH_GATT_NOTIFY_RESPONSE_FIELDS[] = {
+    {offsetof(BluetoothGATTNotifyResponse, address), 1, PROTO_FIELD_UINT64, nullptr},
+    {offsetof(BluetoothGATTNotifyResponse, handle), 2, PROTO_FIELD_UINT32, nullptr},
+};
+ProtoFieldTable BluetoothGATTNotifyResponse::get_field_table() const {
+  return {BLUETOOTH_GATT_NOTIFY_RESPONSE_FIELDS, 2, BLUETOOTH_GATT_NOTIFY_RESPONSE_INDEX, 3};
+}
+#else
 bool BluetoothGATTNotifyResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 1: {
@@ -5842,6 +7299,7 @@ void BluetoothGATTNotifyResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint64(1, this->address);
   buffer.encode_uint32(2, this->handle);
 }
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void BluetoothGATTNotifyResponse::dump_to(std::string &out) const {
   __attribute__((unused)) char buffer[64];
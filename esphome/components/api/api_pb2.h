@@ -155,6 +155,10 @@ enum MediaPlayerCommand : uint32_t {
   MEDIA_PLAYER_COMMAND_MUTE = 3,
   MEDIA_PLAYER_COMMAND_UNMUTE = 4,
 };
+enum BluetoothProxySubscriptionFlag : uint32_t {
+  BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_NONE = 0,
+  BLUETOOTH_PROXY_SUBSCRIPTION_FLAG_RAW_ADVERTISEMENTS = 1,
+};
 enum BluetoothDeviceRequestType : uint32_t {
   BLUETOOTH_DEVICE_REQUEST_TYPE_CONNECT = 0,
   BLUETOOTH_DEVICE_REQUEST_TYPE_DISCONNECT = 1,
@@ -169,14 +173,20 @@ class HelloRequest : public ProtoMessage {
   std::string client_info{};
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class HelloResponse : public ProtoMessage {
  public:
@@ -184,40 +194,62 @@ class HelloResponse : public ProtoMessage {
   uint32_t api_version_minor{0};
   std::string server_info{};
   std::string name{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ConnectRequest : public ProtoMessage {
  public:
   std::string password{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class ConnectResponse : public ProtoMessage {
  public:
   bool invalid_password{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class DisconnectRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -226,7 +258,11 @@ class DisconnectRequest : public ProtoMessage {
 };
 class DisconnectResponse : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -235,7 +271,11 @@ class DisconnectResponse : public ProtoMessage {
 };
 class PingRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -244,7 +284,11 @@ class PingRequest : public ProtoMessage {
 };
 class PingResponse : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -253,7 +297,11 @@ class PingResponse : public ProtoMessage {
 };
 class DeviceInfoRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -273,18 +321,28 @@ class DeviceInfoResponse : public ProtoMessage {
   std::string project_version{};
   uint32_t webserver_port{0};
   uint32_t bluetooth_proxy_version{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -293,7 +351,11 @@ class ListEntitiesRequest : public ProtoMessage {
 };
 class ListEntitiesDoneResponse : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -302,7 +364,11 @@ class ListEntitiesDoneResponse : public ProtoMessage {
 };
 class SubscribeStatesRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -320,29 +386,41 @@ class ListEntitiesBinarySensorResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BinarySensorStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   bool state{false};
   bool missing_state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesCoverResponse : public ProtoMessage {
  public:
@@ -357,15 +435,21 @@ class ListEntitiesCoverResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class CoverStateResponse : public ProtoMessage {
  public:
@@ -374,14 +458,20 @@ class CoverStateResponse : public ProtoMessage {
   float position{0.0f};
   float tilt{0.0f};
   enums::CoverOperation current_operation{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class CoverCommandRequest : public ProtoMessage {
  public:
@@ -393,14 +483,20 @@ class CoverCommandRequest : public ProtoMessage {
   bool has_tilt{false};
   float tilt{0.0f};
   bool stop{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesFanResponse : public ProtoMessage {
  public:
@@ -415,15 +511,21 @@ class ListEntitiesFanResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class FanStateResponse : public ProtoMessage {
  public:
@@ -433,14 +535,20 @@ class FanStateResponse : public ProtoMessage {
   enums::FanSpeed speed{};
   enums::FanDirection direction{};
   int32_t speed_level{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class FanCommandRequest : public ProtoMessage {
  public:
@@ -455,14 +563,20 @@ class FanCommandRequest : public ProtoMessage {
   enums::FanDirection direction{};
   bool has_speed_level{false};
   int32_t speed_level{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesLightResponse : public ProtoMessage {
  public:
@@ -481,15 +595,21 @@ class ListEntitiesLightResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class LightStateResponse : public ProtoMessage {
  public:
@@ -506,15 +626,21 @@ class LightStateResponse : public ProtoMessage {
   float cold_white{0.0f};
   float warm_white{0.0f};
   std::string effect{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class LightCommandRequest : public ProtoMessage {
  public:
@@ -545,15 +671,21 @@ class LightCommandRequest : public ProtoMessage {
   uint32_t flash_length{0};
   bool has_effect{false};
   std::string effect{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesSensorResponse : public ProtoMessage {
  public:
@@ -570,29 +702,41 @@ class ListEntitiesSensorResponse : public ProtoMessage {
   enums::SensorLastResetType legacy_last_reset_type{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SensorStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   float state{0.0f};
   bool missing_state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesSwitchResponse : public ProtoMessage {
  public:
@@ -605,41 +749,59 @@ class ListEntitiesSwitchResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   std::string device_class{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SwitchStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   bool state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SwitchCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
   bool state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesTextSensorResponse : public ProtoMessage {
  public:
@@ -650,60 +812,131 @@ class ListEntitiesTextSensorResponse : public ProtoMessage {
   std::string icon{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class TextSensorStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SubscribeLogsRequest : public ProtoMessage {
  public:
   enums::LogLevel level{};
   bool dump_config{false};
+  bool binary{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SubscribeLogsResponse : public ProtoMessage {
  public:
   enums::LogLevel level{};
   std::string message{};
   bool send_failed{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
+  void encode(ProtoWriteBuffer buffer) const override;
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+#ifndef USE_API_PROTO_TABLES
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
+};
+class SubscribeLogsStringResponse : public ProtoMessage {
+ public:
+  uint32_t id{0};
+  std::string value{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
+  void encode(ProtoWriteBuffer buffer) const override;
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+#ifndef USE_API_PROTO_TABLES
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
+};
+class SubscribeLogsBinaryResponse : public ProtoMessage {
+ public:
+  enums::LogLevel level{};
+  uint32_t tag_id{0};
+  uint32_t format_id{0};
+  uint32_t line{0};
+  uint32_t timestamp{0};
+  std::string args{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SubscribeHomeassistantServicesRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -714,13 +947,19 @@ class HomeassistantServiceMap : public ProtoMessage {
  public:
   std::string key{};
   std::string value{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class HomeassistantServiceResponse : public ProtoMessage {
  public:
@@ -729,18 +968,28 @@ class HomeassistantServiceResponse : public ProtoMessage {
   std::vector<HomeassistantServiceMap> data_template{};
   std::vector<HomeassistantServiceMap> variables{};
   bool is_event{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SubscribeHomeAssistantStatesRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -751,30 +1000,46 @@ class SubscribeHomeAssistantStateResponse : public ProtoMessage {
  public:
   std::string entity_id{};
   std::string attribute{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class HomeAssistantStateResponse : public ProtoMessage {
  public:
   std::string entity_id{};
   std::string state{};
   std::string attribute{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class GetTimeRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -784,40 +1049,58 @@ class GetTimeRequest : public ProtoMessage {
 class GetTimeResponse : public ProtoMessage {
  public:
   uint32_t epoch_seconds{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+#endif
 };
 class ListEntitiesServicesArgument : public ProtoMessage {
  public:
   std::string name{};
   enums::ServiceArgType type{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesServicesResponse : public ProtoMessage {
  public:
   std::string name{};
   uint32_t key{0};
   std::vector<ListEntitiesServicesArgument> args{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class ExecuteServiceArgument : public ProtoMessage {
  public:
@@ -830,28 +1113,40 @@ class ExecuteServiceArgument : public ProtoMessage {
   std::vector<int32_t> int_array{};
   std::vector<float> float_array{};
   std::vector<std::string> string_array{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ExecuteServiceRequest : public ProtoMessage {
  public:
   uint32_t key{0};
   std::vector<ExecuteServiceArgument> args{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class ListEntitiesCameraResponse : public ProtoMessage {
  public:
@@ -862,42 +1157,60 @@ class ListEntitiesCameraResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class CameraImageResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   std::string data{};
   bool done{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class CameraImageRequest : public ProtoMessage {
  public:
   bool single{false};
   bool stream{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesClimateResponse : public ProtoMessage {
  public:
@@ -921,15 +1234,21 @@ class ListEntitiesClimateResponse : public ProtoMessage {
   bool disabled_by_default{false};
   std::string icon{};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ClimateStateResponse : public ProtoMessage {
  public:
@@ -946,15 +1265,21 @@ class ClimateStateResponse : public ProtoMessage {
   std::string custom_fan_mode{};
   enums::ClimatePreset preset{};
   std::string custom_preset{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ClimateCommandRequest : public ProtoMessage {
  public:
@@ -979,15 +1304,21 @@ class ClimateCommandRequest : public ProtoMessage {
   enums::ClimatePreset preset{};
   bool has_custom_preset{false};
   std::string custom_preset{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesNumberResponse : public ProtoMessage {
  public:
@@ -1003,41 +1334,59 @@ class ListEntitiesNumberResponse : public ProtoMessage {
   enums::EntityCategory entity_category{};
   std::string unit_of_measurement{};
   enums::NumberMode mode{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class NumberStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   float state{0.0f};
   bool missing_state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class NumberCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
   float state{0.0f};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+#endif
 };
 class ListEntitiesSelectResponse : public ProtoMessage {
  public:
@@ -1049,43 +1398,61 @@ class ListEntitiesSelectResponse : public ProtoMessage {
   std::vector<std::string> options{};
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SelectStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SelectCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
   std::string state{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class ListEntitiesLockResponse : public ProtoMessage {
  public:
@@ -1100,28 +1467,40 @@ class ListEntitiesLockResponse : public ProtoMessage {
   bool supports_open{false};
   bool requires_code{false};
   std::string code_format{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class LockStateResponse : public ProtoMessage {
  public:
   uint32_t key{0};
   enums::LockState state{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class LockCommandRequest : public ProtoMessage {
  public:
@@ -1129,15 +1508,21 @@ class LockCommandRequest : public ProtoMessage {
   enums::LockCommand command{};
   bool has_code{false};
   std::string code{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ListEntitiesButtonResponse : public ProtoMessage {
  public:
@@ -1149,26 +1534,38 @@ class ListEntitiesButtonResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   std::string device_class{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class ButtonCommandRequest : public ProtoMessage {
  public:
   uint32_t key{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+#endif
 };
 class ListEntitiesMediaPlayerResponse : public ProtoMessage {
  public:
@@ -1180,15 +1577,21 @@ class ListEntitiesMediaPlayerResponse : public ProtoMessage {
   bool disabled_by_default{false};
   enums::EntityCategory entity_category{};
   bool supports_pause{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class MediaPlayerStateResponse : public ProtoMessage {
  public:
@@ -1196,14 +1599,20 @@ class MediaPlayerStateResponse : public ProtoMessage {
   enums::MediaPlayerState state{};
   float volume{0.0f};
   bool muted{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class MediaPlayerCommandRequest : public ProtoMessage {
  public:
@@ -1214,38 +1623,58 @@ class MediaPlayerCommandRequest : public ProtoMessage {
   float volume{0.0f};
   bool has_media_url{false};
   std::string media_url{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage {
  public:
+  uint32_t flags{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothServiceData : public ProtoMessage {
  public:
   std::string uuid{};
   std::vector<uint32_t> legacy_data{};
   std::string data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothLEAdvertisementResponse : public ProtoMessage {
  public:
@@ -1255,26 +1684,76 @@ class BluetoothLEAdvertisementResponse : public ProtoMessage {
   std::vector<std::string> service_uuids{};
   std::vector<BluetoothServiceData> service_data{};
   std::vector<BluetoothServiceData> manufacturer_data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
+};
+class BluetoothLERawAdvertisement : public ProtoMessage {
+ public:
+  uint64_t address{0};
+  int32_t rssi{0};
+  uint32_t address_type{0};
+  std::string data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
+  void encode(ProtoWriteBuffer buffer) const override;
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+#ifndef USE_API_PROTO_TABLES
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
+};
+class BluetoothLERawAdvertisementsResponse : public ProtoMessage {
+ public:
+  std::vector<BluetoothLERawAdvertisement> advertisements{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
+  void encode(ProtoWriteBuffer buffer) const override;
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+#ifndef USE_API_PROTO_TABLES
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+#endif
 };
 class BluetoothDeviceRequest : public ProtoMessage {
  public:
   uint64_t address{0};
   enums::BluetoothDeviceRequestType request_type{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothDeviceConnectionResponse : public ProtoMessage {
  public:
@@ -1282,36 +1761,54 @@ class BluetoothDeviceConnectionResponse : public ProtoMessage {
   bool connected{false};
   uint32_t mtu{0};
   int32_t error{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTGetServicesRequest : public ProtoMessage {
  public:
   uint64_t address{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTDescriptor : public ProtoMessage {
  public:
   std::vector<uint64_t> uuid{};
   uint32_t handle{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTCharacteristic : public ProtoMessage {
  public:
@@ -1319,78 +1816,114 @@ class BluetoothGATTCharacteristic : public ProtoMessage {
   uint32_t handle{0};
   uint32_t properties{0};
   std::vector<BluetoothGATTDescriptor> descriptors{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTService : public ProtoMessage {
  public:
   std::vector<uint64_t> uuid{};
   uint32_t handle{0};
   std::vector<BluetoothGATTCharacteristic> characteristics{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTGetServicesResponse : public ProtoMessage {
  public:
   uint64_t address{0};
   std::vector<BluetoothGATTService> services{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTGetServicesDoneResponse : public ProtoMessage {
  public:
   uint64_t address{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTReadRequest : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTReadResponse : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTWriteRequest : public ProtoMessage {
  public:
@@ -1398,71 +1931,105 @@ class BluetoothGATTWriteRequest : public ProtoMessage {
   uint32_t handle{0};
   bool response{false};
   std::string data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTReadDescriptorRequest : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTWriteDescriptorRequest : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTNotifyRequest : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
   bool enable{false};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTNotifyDataResponse : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class SubscribeBluetoothConnectionsFreeRequest : public ProtoMessage {
  public:
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
@@ -1473,50 +2040,74 @@ class BluetoothConnectionsFreeResponse : public ProtoMessage {
  public:
   uint32_t free{0};
   uint32_t limit{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTErrorResponse : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
   int32_t error{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTWriteResponse : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 class BluetoothGATTNotifyResponse : public ProtoMessage {
  public:
   uint64_t address{0};
   uint32_t handle{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override;
+#else
   void encode(ProtoWriteBuffer buffer) const override;
+#endif
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
 #endif
 
  protected:
+#ifndef USE_API_PROTO_TABLES
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+#endif
 };
 
 }  // namespace api
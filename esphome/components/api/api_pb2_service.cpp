@@ -179,6 +179,16 @@ bool APIServerConnectionBase::send_text_sensor_state_response(const TextSensorSt
 bool APIServerConnectionBase::send_subscribe_logs_response(const SubscribeLogsResponse &msg) {
   return this->send_message_<SubscribeLogsResponse>(msg, 29);
 }
+#ifdef USE_API_BINARY_LOGS
+bool APIServerConnectionBase::send_subscribe_logs_string_response(const SubscribeLogsStringResponse &msg) {
+  return this->send_message_<SubscribeLogsStringResponse>(msg, 85);
+}
+#endif
+#ifdef USE_API_BINARY_LOGS
+bool APIServerConnectionBase::send_subscribe_logs_binary_response(const SubscribeLogsBinaryResponse &msg) {
+  return this->send_message_<SubscribeLogsBinaryResponse>(msg, 86);
+}
+#endif
 bool APIServerConnectionBase::send_homeassistant_service_response(const HomeassistantServiceResponse &msg) {
 #ifdef HAS_PROTO_MESSAGE_DUMP
   ESP_LOGVV(TAG, "send_homeassistant_service_response: %s", msg.dump().c_str());
@@ -337,6 +347,15 @@ bool APIServerConnectionBase::send_bluetooth_le_advertisement_response(const Blu
 }
 #endif
 #ifdef USE_BLUETOOTH_PROXY
+bool APIServerConnectionBase::send_bluetooth_le_raw_advertisements_response(
+    const BluetoothLERawAdvertisementsResponse &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_bluetooth_le_raw_advertisements_response: %s", msg.dump().c_str());
+#endif
+  return this->send_message_<BluetoothLERawAdvertisementsResponse>(msg, 87);
+}
+#endif
+#ifdef USE_BLUETOOTH_PROXY
 #endif
 #ifdef USE_BLUETOOTH_PROXY
 bool APIServerConnectionBase::send_bluetooth_device_connection_response(const BluetoothDeviceConnectionResponse &msg) {
@@ -8,6 +8,7 @@
 #include "esphome/core/hal.h"
 #include "esphome/components/network/util.h"
 #include <cerrno>
+#include <cstring>
 
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -20,11 +21,121 @@ namespace api {
 
 static const char *const TAG = "api";
 
+#ifdef USE_API_BINARY_LOGS
+static void encode_log_int(std::vector<uint8_t> &out, int64_t value) {
+  // zigzag encoding, so that small negative values stay small
+  ProtoVarInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63)).encode(out);
+}
+
+/// Pack the printf arguments for format, in the layout described at SubscribeLogsBinaryResponse.args.
+static void encode_log_args(std::vector<uint8_t> &out, const char *format, va_list args) {
+  for (const char *p = format; *p != '\0'; p++) {
+    if (*p != '%')
+      continue;
+    p++;
+    while (*p != '\0' && strchr("-+ #0", *p) != nullptr)
+      p++;
+    // width and precision, either given inline or as an int argument
+    for (int i = 0; i < 2; i++) {
+      if (*p == '*') {
+        encode_log_int(out, va_arg(args, int));
+        p++;
+      } else {
+        while (*p >= '0' && *p <= '9')
+          p++;
+      }
+      if (i == 0 && *p == '.') {
+        p++;
+      } else {
+        break;
+      }
+    }
+    int longs = 0;
+    bool size = false, long_double = false;
+    for (; *p != '\0' && strchr("hlLqjzt", *p) != nullptr; p++) {
+      if (*p == 'l') {
+        longs++;
+      } else if (*p == 'q' || *p == 'j') {
+        longs = 2;
+      } else if (*p == 'z' || *p == 't') {
+        size = true;
+      } else if (*p == 'L') {
+        long_double = true;
+      }
+    }
+    switch (*p) {
+      case 'd':
+      case 'i':
+      case 'c':
+        if (longs >= 2) {
+          encode_log_int(out, va_arg(args, long long));
+        } else if (longs == 1) {
+          encode_log_int(out, va_arg(args, long));
+        } else if (size) {
+          encode_log_int(out, va_arg(args, ptrdiff_t));
+        } else {
+          encode_log_int(out, va_arg(args, int));
+        }
+        break;
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X':
+        if (longs >= 2) {
+          ProtoVarInt(static_cast<uint64_t>(va_arg(args, unsigned long long))).encode(out);
+        } else if (longs == 1) {
+          ProtoVarInt(static_cast<uint64_t>(va_arg(args, unsigned long))).encode(out);
+        } else if (size) {
+          ProtoVarInt(static_cast<uint64_t>(va_arg(args, size_t))).encode(out);
+        } else {
+          ProtoVarInt(static_cast<uint64_t>(va_arg(args, unsigned int))).encode(out);
+        }
+        break;
+      case 'p':
+        ProtoVarInt(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(args, void *)))).encode(out);
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A': {
+        double value = long_double ? static_cast<double>(va_arg(args, long double)) : va_arg(args, double);
+        uint64_t raw;
+        memcpy(&raw, &value, sizeof(raw));
+        for (int i = 0; i < 8; i++)
+          out.push_back(static_cast<uint8_t>(raw >> (i * 8)));
+        break;
+      }
+      case 's': {
+        const char *value = va_arg(args, const char *);
+        if (value == nullptr)
+          value = "(null)";
+        size_t len = strlen(value);
+        ProtoVarInt(static_cast<uint64_t>(len)).encode(out);
+        out.insert(out.end(), value, value + len);
+        break;
+      }
+      case 'n':
+        va_arg(args, void *);
+        break;
+      case '\0':
+        return;
+      default:
+        // '%%' or an unknown conversion, neither consumes an argument
+        break;
+    }
+  }
+}
+#endif
+
 // APIServer
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
   this->setup_controller();
-  socket_ = socket::socket_ip(SOCK_STREAM, 0);
+  socket_ = socket::socket_ip_monitored(SOCK_STREAM, 0);
   if (socket_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -74,6 +185,12 @@ void APIServer::setup() {
           c->send_log_message(level, tag, message);
       }
     });
+#ifdef USE_API_BINARY_LOGS
+    logger::global_logger->add_on_raw_log_callback(
+        [this](int level, const char *tag, int line, const char *format, va_list args) {
+          this->on_raw_log_(level, tag, line, format, args);
+        });
+#endif
   }
 #endif
 
@@ -93,7 +210,7 @@ void APIServer::setup() {
 }
 void APIServer::loop() {
   // Accept new clients
-  while (true) {
+  while (this->socket_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     auto sock = socket_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -134,6 +251,27 @@ void APIServer::loop() {
     }
   }
 }
+#ifdef USE_API_BINARY_LOGS
+void APIServer::on_raw_log_(int level, const char *tag, int line, const char *format, va_list args) {
+  bool wanted = false;
+  for (auto &c : this->clients_) {
+    if (!c->remove_ && c->wants_binary_log(level))
+      wanted = true;
+  }
+  if (!wanted)
+    return;
+
+  // Pack the arguments once, the same payload is sent to all binary log subscribers
+  this->log_args_buffer_.clear();
+  encode_log_args(this->log_args_buffer_, format, args);
+  uint32_t now = millis();
+  for (auto &c : this->clients_) {
+    if (!c->remove_ && c->wants_binary_log(level))
+      c->send_binary_log_message(level, tag, line, format, now, this->log_args_buffer_);
+  }
+}
+#endif
+
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
@@ -173,111 +311,116 @@ bool APIServer::check_password(const std::string &password) const {
   return result == 0;
 }
 void APIServer::handle_disconnect(APIConnection *conn) {}
+bool APIServer::has_state_subscription_() const {
+  for (const auto &c : this->clients_) {
+    if (c->is_state_subscribed())
+      return true;
+  }
+  return false;
+}
+template<class C> void APIServer::send_state_(const C &msg, uint32_t message_type) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  ESP_LOGVV(TAG, "send_state: %s", msg.dump().c_str());
+#endif
+  this->state_buffer_.clear();
+  ProtoWriteBuffer buffer{&this->state_buffer_};
+  msg.encode(buffer);
+  for (auto &c : this->clients_)
+    c->send_encoded_state(this->state_buffer_, message_type);
+}
 #ifdef USE_BINARY_SENSOR
 void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_binary_sensor_state(obj, state);
+  this->send_state_(APIConnection::make_binary_sensor_state(obj, state), 21);
 }
 #endif
 
 #ifdef USE_COVER
 void APIServer::on_cover_update(cover::Cover *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_cover_state(obj);
+  this->send_state_(APIConnection::make_cover_state(obj), 22);
 }
 #endif
 
 #ifdef USE_FAN
 void APIServer::on_fan_update(fan::Fan *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_fan_state(obj);
+  this->send_state_(APIConnection::make_fan_state(obj), 23);
 }
 #endif
 
 #ifdef USE_LIGHT
 void APIServer::on_light_update(light::LightState *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_light_state(obj);
+  this->send_state_(APIConnection::make_light_state(obj), 24);
 }
 #endif
 
 #ifdef USE_SENSOR
 void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_sensor_state(obj, state);
+  this->send_state_(APIConnection::make_sensor_state(obj, state), 25);
 }
 #endif
 
 #ifdef USE_SWITCH
 void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_switch_state(obj, state);
+  this->send_state_(APIConnection::make_switch_state(obj, state), 26);
 }
 #endif
 
 #ifdef USE_TEXT_SENSOR
 void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_text_sensor_state(obj, state);
+  this->send_state_(APIConnection::make_text_sensor_state(obj, state), 27);
 }
 #endif
 
 #ifdef USE_CLIMATE
 void APIServer::on_climate_update(climate::Climate *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_climate_state(obj);
+  this->send_state_(APIConnection::make_climate_state(obj), 47);
 }
 #endif
 
 #ifdef USE_NUMBER
 void APIServer::on_number_update(number::Number *obj, float state) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_number_state(obj, state);
+  this->send_state_(APIConnection::make_number_state(obj, state), 50);
 }
 #endif
 
 #ifdef USE_SELECT
 void APIServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_select_state(obj, state);
+  this->send_state_(APIConnection::make_select_state(obj, state), 53);
 }
 #endif
 
 #ifdef USE_LOCK
 void APIServer::on_lock_update(lock::Lock *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_lock_state(obj, obj->state);
+  this->send_state_(APIConnection::make_lock_state(obj, obj->state), 59);
 }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
 void APIServer::on_media_player_update(media_player::MediaPlayer *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || !this->has_state_subscription_())
     return;
-  for (auto &c : this->clients_)
-    c->send_media_player_state(obj);
+  this->send_state_(APIConnection::make_media_player_state(obj), 64);
 }
 #endif
 
@@ -297,6 +440,18 @@ void APIServer::send_bluetooth_le_advertisement(const BluetoothLEAdvertisementRe
     client->send_bluetooth_le_advertisement(call);
   }
 }
+void APIServer::send_bluetooth_le_raw_advertisements(const BluetoothLERawAdvertisementsResponse &call) {
+  for (auto &client : this->clients_) {
+    client->send_bluetooth_le_raw_advertisements(call);
+  }
+}
+bool APIServer::is_subscribed_to_bluetooth_le_advertisements(bool raw) const {
+  for (auto &client : this->clients_) {
+    if (client->is_subscribed_to_bluetooth_le_advertisements(raw))
+      return true;
+  }
+  return false;
+}
 void APIServer::send_bluetooth_device_connection(uint64_t address, bool connected, uint16_t mtu, esp_err_t error) {
   BluetoothDeviceConnectionResponse call;
   call.address = address;
@@ -365,13 +520,48 @@ void APIServer::send_bluetooth_gatt_error(uint64_t address, uint16_t handle, esp
 
 #endif
 APIServer::APIServer() { global_api_server = this; }
+// FNV-1 hash of "<entity_id>\0<attribute>", without concatenating the strings
+static uint32_t state_sub_hash(const std::string &entity_id, const std::string &attribute) {
+  uint32_t hash = fnv1_hash(entity_id) * 16777619UL;
+  for (char c : attribute) {
+    hash *= 16777619UL;
+    hash ^= c;
+  }
+  return hash;
+}
+APIServer::HomeAssistantStateSubscription *APIServer::find_state_sub_(const std::string &entity_id,
+                                                                      const std::string &attribute, uint32_t hash) {
+  auto range = this->state_sub_index_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto &sub = this->state_subs_[it->second];
+    if (sub.entity_id == entity_id && sub.attribute.value() == attribute)
+      return &sub;
+  }
+  return nullptr;
+}
 void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                                std::function<void(std::string)> f) {
-  this->state_subs_.push_back(HomeAssistantStateSubscription{
-      .entity_id = std::move(entity_id),
-      .attribute = std::move(attribute),
-      .callback = std::move(f),
-  });
+  // A missing attribute is sent as an empty string, so both subscribe to the same state
+  uint32_t hash = state_sub_hash(entity_id, attribute.value());
+  auto *sub = this->find_state_sub_(entity_id, attribute.value(), hash);
+  if (sub == nullptr) {
+    this->state_sub_index_.emplace(hash, this->state_subs_.size());
+    this->state_subs_.push_back(HomeAssistantStateSubscription{
+        .entity_id = std::move(entity_id),
+        .attribute = std::move(attribute),
+        .callbacks = {},
+    });
+    sub = &this->state_subs_.back();
+  }
+  sub->callbacks.push_back(std::move(f));
+}
+void APIServer::on_home_assistant_state(const std::string &entity_id, const std::string &attribute,
+                                        const std::string &state) {
+  auto *sub = this->find_state_sub_(entity_id, attribute, state_sub_hash(entity_id, attribute));
+  if (sub == nullptr)
+    return;
+  for (auto &callback : sub->callbacks)
+    callback(state);
 }
 const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_state_subs() const {
   return this->state_subs_;
@@ -12,6 +12,8 @@
 #include "user_services.h"
 #include "api_noise_context.h"
 
+#include <unordered_map>
+
 namespace esphome {
 namespace api {
 
@@ -75,6 +77,8 @@ class APIServer : public Component, public Controller {
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call);
 #ifdef USE_BLUETOOTH_PROXY
   void send_bluetooth_le_advertisement(const BluetoothLEAdvertisementResponse &call);
+  void send_bluetooth_le_raw_advertisements(const BluetoothLERawAdvertisementsResponse &call);
+  bool is_subscribed_to_bluetooth_le_advertisements(bool raw) const;
   void send_bluetooth_device_connection(uint64_t address, bool connected, uint16_t mtu, esp_err_t error = ESP_OK);
   void send_bluetooth_connections_free(uint8_t free, uint8_t limit);
   void send_bluetooth_gatt_read_response(const BluetoothGATTReadResponse &call);
@@ -92,15 +96,19 @@ class APIServer : public Component, public Controller {
 
   bool is_connected() const;
 
+  /// A subscription to one entity id and attribute, shared by all callbacks that subscribed to it.
   struct HomeAssistantStateSubscription {
     std::string entity_id;
     optional<std::string> attribute;
-    std::function<void(std::string)> callback;
+    std::vector<std::function<void(std::string)>> callbacks;
   };
 
   void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                       std::function<void(std::string)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
+  /// Call the callbacks subscribed to \p entity_id and \p attribute (empty for the state itself).
+  void on_home_assistant_state(const std::string &entity_id, const std::string &attribute,
+                               const std::string &state);
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 
  protected:
@@ -110,8 +118,21 @@ class APIServer : public Component, public Controller {
   uint32_t last_connected_{0};
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
+  HomeAssistantStateSubscription *find_state_sub_(const std::string &entity_id, const std::string &attribute,
+                                                  uint32_t hash);
   std::vector<HomeAssistantStateSubscription> state_subs_;
+  // Hash of entity id and attribute -> index in state_subs_
+  std::unordered_multimap<uint32_t, size_t> state_sub_index_;
   std::vector<UserServiceDescriptor *> user_services_;
+  bool has_state_subscription_() const;
+  template<class C> void send_state_(const C &msg, uint32_t message_type);
+  // State messages are encoded once into this buffer and shared by all subscribed clients
+  std::vector<uint8_t> state_buffer_;
+#ifdef USE_API_BINARY_LOGS
+  void on_raw_log_(int level, const char *tag, int line, const char *format, va_list args);
+  // Re-used to prevent allocations
+  std::vector<uint8_t> log_args_buffer_;
+#endif
 
 #ifdef USE_API_NOISE
   std::shared_ptr<APINoiseContext> noise_ctx_ = std::make_shared<APINoiseContext>();
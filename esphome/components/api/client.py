@@ -1,17 +1,256 @@
 import asyncio
+import importlib.metadata
 import logging
+import re
+import struct
 from datetime import datetime
-from typing import Optional
+from typing import Dict, Optional
 
 from aioesphomeapi import APIClient, ReconnectLogic, APIConnectionError, LogLevel
+from aioesphomeapi.api_pb2 import SubscribeLogsResponse
 import zeroconf
 
 from esphome.const import CONF_KEY, CONF_PORT, CONF_PASSWORD, __version__
 from esphome.util import safe_print
-from . import CONF_ENCRYPTION
+from . import CONF_BINARY_LOGS, CONF_ENCRYPTION
 
 _LOGGER = logging.getLogger(__name__)
 
+# aioesphomeapi has no public API to send a request it doesn't know the fields of, or to
+# receive messages it doesn't know. The binary logs use its internals, which were checked
+# against these versions, [minimum, maximum).
+BINARY_LOGS_AIOESPHOMEAPI_VERSIONS = ((10, 13), (11, 0))
+
+# Message ids from api.proto
+SUBSCRIBE_LOGS_STRING_RESPONSE = 85
+SUBSCRIBE_LOGS_BINARY_RESPONSE = 86
+
+# Same as LOG_LEVEL_COLORS/LOG_LEVEL_LETTERS in logger.cpp
+LOG_LEVEL_COLORS = [
+    "",
+    "\033[1;31m",
+    "\033[0;33m",
+    "\033[0;32m",
+    "\033[0;35m",
+    "\033[0;36m",
+    "\033[0;37m",
+    "\033[0;38m",
+]
+LOG_LEVEL_LETTERS = ["", "E", "W", "I", "C", "D", "V", "VV"]
+LOG_RESET_COLOR = "\033[0m"
+
+PRINTF_PATTERN = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|q|j|z|t)?([diouxXeEfFgGaAcspn%])"
+)
+
+
+def _encode_varint(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        bits = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(bits | 0x80)
+        else:
+            out.append(bits)
+            return bytes(out)
+
+
+def _decode_varint(data: bytes, pos: int):
+    result = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        result |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return result, pos
+
+
+def _decode_zigzag(value: int) -> int:
+    return (value >> 1) ^ -(value & 1)
+
+
+def _decode_fields(data: bytes) -> Dict[int, object]:
+    """Decode the varint and length-delimited fields of a protobuf message."""
+    fields = {}
+    pos = 0
+    while pos < len(data):
+        key, pos = _decode_varint(data, pos)
+        field_id, wire_type = key >> 3, key & 7
+        if wire_type == 0:
+            fields[field_id], pos = _decode_varint(data, pos)
+        elif wire_type == 2:
+            length, pos = _decode_varint(data, pos)
+            fields[field_id] = data[pos : pos + length]
+            pos += length
+        elif wire_type == 5:
+            pos += 4
+        elif wire_type == 1:
+            pos += 8
+        else:
+            raise ValueError(f"Unsupported wire type {wire_type}")
+    return fields
+
+
+def make_binary_logs_request(level: int, dump_config: bool):
+    """Create a SubscribeLogsRequest with the binary field set.
+
+    aioesphomeapi's generated message doesn't know the field yet, so it is parsed in
+    as an unknown field, which protobuf keeps when serializing the request again.
+    """
+    # pylint: disable=import-outside-toplevel
+    from aioesphomeapi.api_pb2 import SubscribeLogsRequest
+
+    req = SubscribeLogsRequest()
+    req.ParseFromString(
+        _encode_varint(1 << 3)
+        + _encode_varint(level)
+        + _encode_varint(2 << 3)
+        + _encode_varint(int(dump_config))
+        + _encode_varint(3 << 3)
+        + _encode_varint(1)
+    )
+    return req
+
+
+class SubscribeLogsStringResponse:
+    """Implements the parts of the protobuf message interface aioesphomeapi uses."""
+
+    def __init__(self):
+        self.id = 0
+        self.value = ""
+
+    def ParseFromString(self, data: bytes):  # pylint: disable=invalid-name
+        fields = _decode_fields(data)
+        self.id = fields.get(1, 0)
+        self.value = fields.get(2, b"").decode("utf8", "backslashreplace")
+
+
+class SubscribeLogsBinaryResponse:
+    def __init__(self):
+        self.level = 0
+        self.tag_id = 0
+        self.format_id = 0
+        self.line = 0
+        self.timestamp = 0
+        self.args = b""
+
+    def ParseFromString(self, data: bytes):  # pylint: disable=invalid-name
+        fields = _decode_fields(data)
+        self.level = fields.get(1, 0)
+        self.tag_id = fields.get(2, 0)
+        self.format_id = fields.get(3, 0)
+        self.line = fields.get(4, 0)
+        self.timestamp = fields.get(5, 0)
+        self.args = fields.get(6, b"")
+
+
+def format_packed_args(fmt: str, args: bytes) -> str:
+    """Apply the packed arguments of a SubscribeLogsBinaryResponse to its printf format."""
+    pos = 0
+
+    def read_int():
+        nonlocal pos
+        value, pos = _decode_varint(args, pos)
+        return value
+
+    def replace(match):
+        nonlocal pos
+        flags, width, precision, _, conv = match.groups()
+        if conv == "%":
+            return "%"
+        if width == "*":
+            width = str(_decode_zigzag(read_int()))
+        if precision == "*":
+            precision = str(_decode_zigzag(read_int()))
+        spec = "%" + flags + (width or "")
+        if precision is not None:
+            spec += "." + precision
+        if conv in "dic":
+            value = _decode_zigzag(read_int())
+            return (spec + ("c" if conv == "c" else "d")) % value
+        if conv in "uoxX":
+            return (spec + ("d" if conv == "u" else conv)) % read_int()
+        if conv == "p":
+            return (spec.replace("#", "") + "#x") % read_int()
+        if conv in "eEfFgGaA":
+            (value,) = struct.unpack_from("<d", args, pos)
+            pos += 8
+            if conv in "aA":
+                return value.hex()
+            return (spec + conv) % value
+        if conv == "s":
+            length = read_int()
+            value = args[pos : pos + length].decode("utf8", "backslashreplace")
+            pos += length
+            return (spec + "s") % value
+        # %n
+        return ""
+
+    try:
+        return PRINTF_PATTERN.sub(replace, fmt)
+    except (IndexError, struct.error, TypeError, ValueError):
+        return fmt + " <invalid log arguments>"
+
+
+class BinaryLogDecoder:
+    """Reconstructs log lines from the SubscribeLogs*Response binary messages of one connection."""
+
+    def __init__(self):
+        self.strings: Dict[int, str] = {}
+
+    def reset(self):
+        # String ids are only valid for the connection they were sent on
+        self.strings.clear()
+
+    def on_string(self, msg: SubscribeLogsStringResponse):
+        self.strings[msg.id] = msg.value
+
+    def format(self, msg: SubscribeLogsBinaryResponse) -> str:
+        level = min(max(msg.level, 0), len(LOG_LEVEL_COLORS) - 1)
+        tag = self.strings.get(msg.tag_id, "?")
+        fmt = self.strings.get(msg.format_id)
+        if fmt is None:
+            text = f"<unknown format {msg.format_id}>"
+        else:
+            text = format_packed_args(fmt, msg.args).rstrip("\n")
+        return (
+            f"{LOG_LEVEL_COLORS[level]}[{LOG_LEVEL_LETTERS[level]}][{tag}:{msg.line:03}]: "
+            f"{text}{LOG_RESET_COLOR}"
+        )
+
+
+def _aioesphomeapi_version():
+    try:
+        version = importlib.metadata.version("aioesphomeapi")
+        return tuple(int(part) for part in version.split(".")[:2])
+    except (importlib.metadata.PackageNotFoundError, ValueError):
+        return None
+
+
+def _register_binary_log_messages() -> bool:
+    version = _aioesphomeapi_version()
+    minimum, maximum = BINARY_LOGS_AIOESPHOMEAPI_VERSIONS
+    if version is None or not minimum <= version < maximum:
+        _LOGGER.warning(
+            "Binary logs are not supported with this aioesphomeapi version, "
+            "falling back to plain text logs"
+        )
+        return False
+    try:
+        # pylint: disable=import-outside-toplevel
+        from aioesphomeapi.connection import APIConnection as _APIConnection
+        from aioesphomeapi.core import MESSAGE_TYPE_TO_PROTO
+    except ImportError:
+        return False
+    if not hasattr(_APIConnection, "send_message_callback_response"):
+        return False
+    MESSAGE_TYPE_TO_PROTO[SUBSCRIBE_LOGS_STRING_RESPONSE] = SubscribeLogsStringResponse
+    MESSAGE_TYPE_TO_PROTO[SUBSCRIBE_LOGS_BINARY_RESPONSE] = SubscribeLogsBinaryResponse
+    return True
+
 
 async def async_run_logs(config, address):
     conf = config["api"]
@@ -29,20 +268,44 @@ async def async_run_logs(config, address):
         noise_psk=noise_psk,
     )
     first_connect = True
+    binary_logs = conf.get(CONF_BINARY_LOGS, False) and _register_binary_log_messages()
+    decoder = BinaryLogDecoder()
 
     def on_log(msg):
         time_ = datetime.now().time().strftime("[%H:%M:%S]")
         text = msg.message.decode("utf8", "backslashreplace")
         safe_print(time_ + text)
 
+    def on_binary_message(msg):
+        if isinstance(msg, SubscribeLogsStringResponse):
+            decoder.on_string(msg)
+        elif isinstance(msg, SubscribeLogsBinaryResponse):
+            time_ = datetime.now().time().strftime("[%H:%M:%S]")
+            safe_print(time_ + decoder.format(msg))
+        elif isinstance(msg, SubscribeLogsResponse):
+            # Sent as text when the device has no room left for more strings
+            on_log(msg)
+
+    async def subscribe_binary_logs(dump_config):
+        decoder.reset()
+        # Only used with the aioesphomeapi versions accepted by _register_binary_log_messages()
+        # pylint: disable=protected-access
+        cli._connection.send_message_callback_response(
+            make_binary_logs_request(LogLevel.LOG_LEVEL_VERY_VERBOSE, dump_config),
+            on_binary_message,
+        )
+
     async def on_connect():
         nonlocal first_connect
         try:
-            await cli.subscribe_logs(
-                on_log,
-                log_level=LogLevel.LOG_LEVEL_VERY_VERBOSE,
-                dump_config=first_connect,
-            )
+            if binary_logs:
+                await subscribe_binary_logs(first_connect)
+            else:
+                await cli.subscribe_logs(
+                    on_log,
+                    log_level=LogLevel.LOG_LEVEL_VERY_VERBOSE,
+                    dump_config=first_connect,
+                )
             first_connect = False
         except APIConnectionError:
             cli.disconnect()
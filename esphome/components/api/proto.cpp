@@ -35,6 +35,21 @@ void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
         i += consumed;
         break;
       }
+      case 1: {  // 64-bit
+        if (length - i < 8) {
+          ESP_LOGV(TAG, "Out-of-bounds Fixed64-bit at %u", i);
+          error = true;
+          break;
+        }
+        uint64_t val = 0;
+        for (int j = 7; j >= 0; j--)
+          val = (val << 8) | buffer[i + j];
+        if (!this->decode_64bit(field_id, Proto64Bit(val))) {
+          ESP_LOGV(TAG, "Cannot decode 64-bit field %u!", field_id);
+        }
+        i += 8;
+        break;
+      }
       case 2: {  // Length-delimited
         res = ProtoVarInt::parse(&buffer[i], length - i, &consumed);
         if (!res.has_value()) {
@@ -79,6 +94,168 @@ void ProtoMessage::decode(const uint8_t *buffer, size_t length) {
   }
 }
 
+#ifdef USE_API_PROTO_TABLES
+// Generated messages derive only from ProtoMessage, so the base is at the start of the object and the
+// field offsets can be applied to `this`. The same holds for the nested messages stored in fields.
+void *ProtoMessage::find_field_(uint32_t field_id, const ProtoFieldInfo **info) {
+  ProtoFieldTable table = this->get_field_table();
+  if (field_id >= table.index_size || table.index[field_id] == 0)
+    return nullptr;
+  const ProtoFieldInfo &field = table.fields[table.index[field_id] - 1];
+  *info = &field;
+  return reinterpret_cast<uint8_t *>(this) + field.offset;
+}
+
+/// Returns the value to decode into, appending a new element for repeated fields.
+static void *field_value(const ProtoFieldInfo *field, void *ptr) {
+  return field->repeated != nullptr ? field->repeated->add(ptr) : ptr;
+}
+
+bool ProtoMessage::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  const ProtoFieldInfo *field;
+  void *ptr = this->find_field_(field_id, &field);
+  if (ptr == nullptr)
+    return false;
+  switch (field->type) {
+    case PROTO_FIELD_BOOL:
+      *static_cast<bool *>(field_value(field, ptr)) = value.as_bool();
+      return true;
+    case PROTO_FIELD_REPEATED_BOOL:
+      static_cast<std::vector<bool> *>(ptr)->push_back(value.as_bool());
+      return true;
+    case PROTO_FIELD_UINT32:
+    case PROTO_FIELD_ENUM:
+      *static_cast<uint32_t *>(field_value(field, ptr)) = value.as_uint32();
+      return true;
+    case PROTO_FIELD_INT32:
+      *static_cast<int32_t *>(field_value(field, ptr)) = value.as_int32();
+      return true;
+    case PROTO_FIELD_SINT32:
+      *static_cast<int32_t *>(field_value(field, ptr)) = value.as_sint32();
+      return true;
+    case PROTO_FIELD_UINT64:
+      *static_cast<uint64_t *>(field_value(field, ptr)) = value.as_uint64();
+      return true;
+    case PROTO_FIELD_INT64:
+      *static_cast<int64_t *>(field_value(field, ptr)) = value.as_int64();
+      return true;
+    case PROTO_FIELD_SINT64:
+      *static_cast<int64_t *>(field_value(field, ptr)) = value.as_sint64();
+      return true;
+    default:
+      return false;
+  }
+}
+bool ProtoMessage::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  const ProtoFieldInfo *field;
+  void *ptr = this->find_field_(field_id, &field);
+  if (ptr == nullptr)
+    return false;
+  switch (field->type) {
+    case PROTO_FIELD_STRING:
+      *static_cast<std::string *>(field_value(field, ptr)) = value.as_string();
+      return true;
+    case PROTO_FIELD_MESSAGE:
+      value.decode_to(*static_cast<ProtoMessage *>(field_value(field, ptr)));
+      return true;
+    default:
+      return false;
+  }
+}
+bool ProtoMessage::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  const ProtoFieldInfo *field;
+  void *ptr = this->find_field_(field_id, &field);
+  if (ptr == nullptr)
+    return false;
+  switch (field->type) {
+    case PROTO_FIELD_FIXED32:
+      *static_cast<uint32_t *>(field_value(field, ptr)) = value.as_fixed32();
+      return true;
+    case PROTO_FIELD_FLOAT:
+      *static_cast<float *>(field_value(field, ptr)) = value.as_float();
+      return true;
+    default:
+      return false;
+  }
+}
+bool ProtoMessage::decode_64bit(uint32_t field_id, Proto64Bit value) {
+  const ProtoFieldInfo *field;
+  void *ptr = this->find_field_(field_id, &field);
+  if (ptr == nullptr)
+    return false;
+  switch (field->type) {
+    case PROTO_FIELD_FIXED64:
+      *static_cast<uint64_t *>(field_value(field, ptr)) = value.as_fixed64();
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void encode_field(ProtoWriteBuffer &buffer, const ProtoFieldInfo &field, const void *ptr, bool force) {
+  uint32_t id = field.field_id;
+  switch (field.type) {
+    case PROTO_FIELD_BOOL:
+      buffer.encode_bool(id, *static_cast<const bool *>(ptr), force);
+      break;
+    case PROTO_FIELD_UINT32:
+    case PROTO_FIELD_ENUM:
+      buffer.encode_uint32(id, *static_cast<const uint32_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_INT32:
+      buffer.encode_int32(id, *static_cast<const int32_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_SINT32:
+      buffer.encode_sint32(id, *static_cast<const int32_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_UINT64:
+      buffer.encode_uint64(id, *static_cast<const uint64_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_INT64:
+      buffer.encode_int64(id, *static_cast<const int64_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_SINT64:
+      buffer.encode_sint64(id, *static_cast<const int64_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_FIXED32:
+      buffer.encode_fixed32(id, *static_cast<const uint32_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_FIXED64:
+      buffer.encode_fixed64(id, *static_cast<const uint64_t *>(ptr), force);
+      break;
+    case PROTO_FIELD_FLOAT:
+      buffer.encode_float(id, *static_cast<const float *>(ptr), force);
+      break;
+    case PROTO_FIELD_STRING:
+      buffer.encode_string(id, *static_cast<const std::string *>(ptr), force);
+      break;
+    case PROTO_FIELD_MESSAGE:
+      buffer.encode_message(id, *static_cast<const ProtoMessage *>(ptr), force);
+      break;
+    default:
+      break;
+  }
+}
+
+void ProtoMessage::encode(ProtoWriteBuffer buffer) const {
+  ProtoFieldTable table = this->get_field_table();
+  for (size_t i = 0; i < table.count; i++) {
+    const ProtoFieldInfo &field = table.fields[i];
+    const void *ptr = reinterpret_cast<const uint8_t *>(this) + field.offset;
+    if (field.type == PROTO_FIELD_REPEATED_BOOL) {
+      for (bool it : *static_cast<const std::vector<bool> *>(ptr))
+        buffer.encode_bool(field.field_id, it, true);
+    } else if (field.repeated != nullptr) {
+      size_t size = field.repeated->size(ptr);
+      for (size_t j = 0; j < size; j++)
+        encode_field(buffer, field, field.repeated->get(ptr, j), true);
+    } else {
+      encode_field(buffer, field, ptr, false);
+    }
+  }
+}
+#endif
+
 #ifdef HAS_PROTO_MESSAGE_DUMP
 std::string ProtoMessage::dump() const {
   std::string out;
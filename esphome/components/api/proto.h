@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
@@ -99,6 +100,7 @@ class ProtoLengthDelimited {
     msg.decode(this->value_, this->length_);
     return msg;
   }
+  template<class C> void decode_to(C &msg) const { msg.decode(this->value_, this->length_); }
 
  protected:
   const uint8_t *const value_;
@@ -199,7 +201,7 @@ class ProtoWriteBuffer {
     if (value == 0 && !force)
       return;
 
-    this->encode_field_raw(field_id, 5);
+    this->encode_field_raw(field_id, 1);
     this->write((value >> 0) & 0xFF);
     this->write((value >> 8) & 0xFF);
     this->write((value >> 16) & 0xFF);
@@ -270,10 +272,71 @@ class ProtoWriteBuffer {
   std::vector<uint8_t> *buffer_;
 };
 
+#ifdef USE_API_PROTO_TABLES
+enum ProtoFieldType : uint8_t {
+  PROTO_FIELD_BOOL,
+  PROTO_FIELD_REPEATED_BOOL,
+  PROTO_FIELD_UINT32,
+  PROTO_FIELD_INT32,
+  PROTO_FIELD_SINT32,
+  PROTO_FIELD_UINT64,
+  PROTO_FIELD_INT64,
+  PROTO_FIELD_SINT64,
+  PROTO_FIELD_ENUM,
+  PROTO_FIELD_FIXED32,
+  PROTO_FIELD_FIXED64,
+  PROTO_FIELD_FLOAT,
+  PROTO_FIELD_STRING,
+  PROTO_FIELD_MESSAGE,
+};
+
+/// Type-erased access to the std::vector behind a repeated field.
+struct ProtoRepeatedOps {
+  size_t (*size)(const void *vec);
+  const void *(*get)(const void *vec, size_t index);
+  void *(*add)(void *vec);
+};
+
+template<typename T> struct ProtoRepeated {
+  static size_t size(const void *vec) { return static_cast<const std::vector<T> *>(vec)->size(); }
+  static const void *get(const void *vec, size_t index) { return &(*static_cast<const std::vector<T> *>(vec))[index]; }
+  static void *add(void *vec) {
+    auto *v = static_cast<std::vector<T> *>(vec);
+    v->emplace_back();
+    return &v->back();
+  }
+  static const ProtoRepeatedOps OPS;
+};
+template<typename T> const ProtoRepeatedOps ProtoRepeated<T>::OPS = {size, get, add};
+
+struct ProtoFieldInfo {
+  /// Offset of the member inside the message class
+  uint16_t offset;
+  uint8_t field_id;
+  ProtoFieldType type;
+  /// Set for repeated fields, except for repeated bools which are always std::vector<bool>
+  const ProtoRepeatedOps *repeated;
+};
+
+struct ProtoFieldTable {
+  const ProtoFieldInfo *fields;
+  size_t count;
+  /// Position of each field in fields + 1, by field id. 0 for ids the message doesn't have.
+  const uint8_t *index;
+  size_t index_size;
+};
+#endif
+
 class ProtoMessage {
  public:
   virtual ~ProtoMessage() = default;
+#ifdef USE_API_PROTO_TABLES
+  /// Encode using the field table, produces the same output as the generated per-message encoders.
+  void encode(ProtoWriteBuffer buffer) const;
+  virtual ProtoFieldTable get_field_table() const = 0;
+#else
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+#endif
   void decode(const uint8_t *buffer, size_t length);
 #ifdef HAS_PROTO_MESSAGE_DUMP
   std::string dump() const;
@@ -281,10 +344,18 @@ class ProtoMessage {
 #endif
 
  protected:
+#ifdef USE_API_PROTO_TABLES
+  bool decode_varint(uint32_t field_id, ProtoVarInt value);
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value);
+  bool decode_32bit(uint32_t field_id, Proto32Bit value);
+  bool decode_64bit(uint32_t field_id, Proto64Bit value);
+  void *find_field_(uint32_t field_id, const ProtoFieldInfo **info);
+#else
   virtual bool decode_varint(uint32_t field_id, ProtoVarInt value) { return false; }
   virtual bool decode_length(uint32_t field_id, ProtoLengthDelimited value) { return false; }
   virtual bool decode_32bit(uint32_t field_id, Proto32Bit value) { return false; }
   virtual bool decode_64bit(uint32_t field_id, Proto64Bit value) { return false; }
+#endif
 };
 
 template<typename T> const char *proto_enum_to_string(T value);
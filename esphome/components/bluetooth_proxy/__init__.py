@@ -7,6 +7,10 @@ AUTO_LOAD = ["esp32_ble_client", "esp32_ble_tracker"]
 DEPENDENCIES = ["api", "esp32"]
 CODEOWNERS = ["@jesserockz"]
 
+CONF_ADVERTISEMENT_BATCH_SIZE = "advertisement_batch_size"
+CONF_ADVERTISEMENT_BATCH_INTERVAL = "advertisement_batch_interval"
+CONF_ADVERTISEMENT_DEDUP_WINDOW = "advertisement_dedup_window"
+
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
 
@@ -18,6 +22,15 @@ CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(BluetoothProxy),
         cv.Optional(CONF_ACTIVE, default=False): cv.boolean,
+        cv.Optional(CONF_ADVERTISEMENT_BATCH_SIZE, default=16): cv.int_range(
+            min=1, max=64
+        ),
+        cv.Optional(
+            CONF_ADVERTISEMENT_BATCH_INTERVAL, default="100ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_ADVERTISEMENT_DEDUP_WINDOW, default="1s"
+        ): cv.positive_time_period_milliseconds,
     }
 ).extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
 
@@ -27,6 +40,11 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    cg.add(var.set_advertisement_batch_size(config[CONF_ADVERTISEMENT_BATCH_SIZE]))
+    cg.add(
+        var.set_advertisement_batch_interval(config[CONF_ADVERTISEMENT_BATCH_INTERVAL])
+    )
+    cg.add(var.set_advertisement_dedup_window(config[CONF_ADVERTISEMENT_DEDUP_WINDOW]))
 
     await esp32_ble_tracker.register_client(var, config)
 
@@ -1,5 +1,6 @@
 #include "bluetooth_proxy.h"
 
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 #ifdef USE_ESP32
@@ -24,7 +25,12 @@ bool BluetoothProxy::parse_device(const esp32_ble_tracker::ESPBTDevice &device)
     return false;
   ESP_LOGV(TAG, "Proxying packet from %s - %s. RSSI: %d dB", device.get_name().c_str(), device.address_str().c_str(),
            device.get_rssi());
-  this->send_api_packet_(device);
+  // Raw batches don't need the advertisement to be parsed on the proxy at all. Only they drop repeated advertisements,
+  // clients of parsed advertisements keep getting every advertisement with its RSSI, as before raw batches existed.
+  if (api::global_api_server->is_subscribed_to_bluetooth_le_advertisements(true) && !this->is_duplicate_(device))
+    this->queue_raw_advertisement_(device);
+  if (api::global_api_server->is_subscribed_to_bluetooth_le_advertisements(false))
+    this->send_api_packet_(device);
 
   if (this->address_ == 0)
     return true;
@@ -33,6 +39,47 @@ bool BluetoothProxy::parse_device(const esp32_ble_tracker::ESPBTDevice &device)
   return true;
 }
 
+bool BluetoothProxy::is_duplicate_(const esp32_ble_tracker::ESPBTDevice &device) {
+  if (this->advertisement_dedup_window_ == 0)
+    return false;
+  const auto &result = device.get_scan_result();
+  // Scan responses get their own entry, so that devices alternating advertisement and scan response still match
+  const uint64_t key = (device.address_uint64() << 1) | (result.adv_data_len == 0 ? 1 : 0);
+  const uint32_t hash =
+      fnv1_hash(reinterpret_cast<const char *>(result.ble_adv), result.adv_data_len + result.scan_rsp_len);
+  auto &entry = this->advertisement_cache_[key % ADVERTISEMENT_CACHE_SIZE];
+  const uint32_t now = device.get_timestamp();
+  if (entry.key == key && entry.hash == hash && now - entry.sent_at < this->advertisement_dedup_window_)
+    return true;
+  entry.key = key;
+  entry.hash = hash;
+  entry.sent_at = now;
+  return false;
+}
+
+void BluetoothProxy::queue_raw_advertisement_(const esp32_ble_tracker::ESPBTDevice &device) {
+  const auto &result = device.get_scan_result();
+  auto &advertisements = this->raw_advertisements_.advertisements;
+  if (advertisements.empty())
+    this->advertisement_batch_started_at_ = millis();
+  advertisements.emplace_back();
+  auto &advertisement = advertisements.back();
+  advertisement.address = device.address_uint64();
+  advertisement.rssi = device.get_rssi();
+  advertisement.address_type = device.get_address_type();
+  advertisement.data.assign(reinterpret_cast<const char *>(result.ble_adv), result.adv_data_len + result.scan_rsp_len);
+  if (advertisements.size() >= this->advertisement_batch_size_)
+    this->flush_raw_advertisements_();
+}
+
+void BluetoothProxy::flush_raw_advertisements_() {
+  if (this->raw_advertisements_.advertisements.empty())
+    return;
+  ESP_LOGV(TAG, "Sending %u raw advertisements", this->raw_advertisements_.advertisements.size());
+  api::global_api_server->send_bluetooth_le_raw_advertisements(this->raw_advertisements_);
+  this->raw_advertisements_.advertisements.clear();
+}
+
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -164,10 +211,19 @@ void BluetoothProxy::gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if
   }
 }
 
-void BluetoothProxy::dump_config() { ESP_LOGCONFIG(TAG, "Bluetooth Proxy:"); }
+void BluetoothProxy::dump_config() {
+  ESP_LOGCONFIG(TAG, "Bluetooth Proxy:");
+  ESP_LOGCONFIG(TAG, "  Advertisement Batch Size: %u", this->advertisement_batch_size_);
+  ESP_LOGCONFIG(TAG, "  Advertisement Batch Interval: %u ms", this->advertisement_batch_interval_);
+  ESP_LOGCONFIG(TAG, "  Advertisement Dedup Window: %u ms", this->advertisement_dedup_window_);
+}
 
 void BluetoothProxy::loop() {
   BLEClientBase::loop();
+  if (!this->raw_advertisements_.advertisements.empty() &&
+      millis() - this->advertisement_batch_started_at_ >= this->advertisement_batch_interval_) {
+    this->flush_raw_advertisements_();
+  }
   if (this->state_ != espbt::ClientState::IDLE && !api::global_api_server->is_connected()) {
     ESP_LOGI(TAG, "[%s] Disconnecting.", this->address_str().c_str());
     auto err = esp_ble_gattc_close(this->gattc_if_, this->conn_id_);
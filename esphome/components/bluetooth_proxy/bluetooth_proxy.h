@@ -41,12 +41,35 @@ class BluetoothProxy : public BLEClientBase {
 
   void set_active(bool active) { this->active_ = active; }
   bool has_active() { return this->active_; }
+  void set_advertisement_batch_size(size_t batch_size) { this->advertisement_batch_size_ = batch_size; }
+  void set_advertisement_batch_interval(uint32_t interval) { this->advertisement_batch_interval_ = interval; }
+  /// Drop advertisements from raw batches that repeat the payload of the same device within \p window ms, 0 disables.
+  /// Clients that subscribed to parsed advertisements are not affected.
+  void set_advertisement_dedup_window(uint32_t window) { this->advertisement_dedup_window_ = window; }
 
  protected:
+  /// Number of (address, payload) pairs remembered to drop repeated advertisements, see is_duplicate_().
+  static const size_t ADVERTISEMENT_CACHE_SIZE = 64;
+  struct AdvertisementCacheEntry {
+    uint64_t key;
+    uint32_t hash;
+    uint32_t sent_at;
+  };
+
+  bool is_duplicate_(const esp32_ble_tracker::ESPBTDevice &device);
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  void queue_raw_advertisement_(const esp32_ble_tracker::ESPBTDevice &device);
+  void flush_raw_advertisements_();
 
   int16_t send_service_{-1};
   bool active_;
+
+  api::BluetoothLERawAdvertisementsResponse raw_advertisements_;
+  size_t advertisement_batch_size_{16};
+  uint32_t advertisement_batch_interval_{100};
+  uint32_t advertisement_batch_started_at_{0};
+  uint32_t advertisement_dedup_window_{0};
+  AdvertisementCacheEntry advertisement_cache_[ADVERTISEMENT_CACHE_SIZE]{};
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import register_entity_key, setup_entity
 from esphome import automation
 from esphome.components import mqtt
 from esphome.const import (
@@ -273,6 +273,7 @@ async def register_climate(var, config):
     if not CORE.has_id(config[CONF_ID]):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_climate(var))
+    register_entity_key("climate", config)
     await setup_climate_core_(var, config)
 
 
@@ -19,7 +19,7 @@ from esphome.const import (
     CONF_TRIGGER_ID,
 )
 from esphome.core import CORE, coroutine_with_priority
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import register_entity_key, setup_entity
 
 IS_PLATFORM_COMPONENT = True
 
@@ -145,6 +145,7 @@ async def register_cover(var, config):
     if not CORE.has_id(config[CONF_ID]):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_cover(var))
+    register_entity_key("cover", config)
     await setup_cover_core_(var, config)
 
 
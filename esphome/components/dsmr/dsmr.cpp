@@ -1,19 +1,15 @@
 #ifdef USE_ARDUINO
 
 #include "dsmr.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-#include <AES.h>
-#include <Crypto.h>
-#include <GCM.h>
-
 namespace esphome {
 namespace dsmr {
 
 static const char *const TAG = "dsmr";
 
 void Dsmr::setup() {
-  this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
   if (this->request_pin_ != nullptr) {
     this->request_pin_->setup();
   }
@@ -68,7 +64,7 @@ bool Dsmr::available_within_timeout_() {
   }
   // When we're not in the process of reading a telegram, then there is
   // no need to actively wait for new data to come in.
-  if (!header_found_) {
+  if (!this->header_found_ && this->crypt_bytes_read_ == 0) {
     return false;
   }
   // A telegram is being read. The smart meter might not deliver a telegram
@@ -125,152 +121,196 @@ void Dsmr::stop_requesting_data_() {
 }
 
 void Dsmr::reset_telegram_() {
-  this->header_found_ = false;
-  this->footer_found_ = false;
-  this->bytes_read_ = 0;
+  this->reset_parser_();
   this->crypt_bytes_read_ = 0;
   this->crypt_telegram_len_ = 0;
   this->last_read_time_ = 0;
 }
 
+void Dsmr::reset_parser_() {
+  this->header_found_ = false;
+  this->footer_found_ = false;
+  this->bytes_read_ = 0;
+  this->line_.clear();
+  this->line_ended_ = false;
+  this->identification_parsed_ = false;
+  this->crc_ = 0;
+  this->data_ = MyData();
+}
+
 void Dsmr::receive_telegram_() {
   while (this->available_within_timeout_()) {
-    const char c = this->read();
-
-    // Find a new telegram header, i.e. forward slash.
-    if (c == '/') {
-      ESP_LOGV(TAG, "Header of telegram found");
-      this->reset_telegram_();
-      this->header_found_ = true;
-    }
-    if (!this->header_found_)
-      continue;
-
-    // Check for buffer overflow.
-    if (this->bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+    if (this->parse_byte_(this->read())) {
+      this->stop_requesting_data_();
       return;
     }
+  }
+}
 
-    // Some v2.2 or v3 meters will send a new value which starts with '('
-    // in a new line, while the value belongs to the previous ObisId. For
-    // proper parsing, remove these new line characters.
-    if (c == '(') {
-      while (true) {
-        auto previous_char = this->telegram_[this->bytes_read_ - 1];
-        if (previous_char == '\n' || previous_char == '\r') {
-          this->bytes_read_--;
-        } else {
-          break;
-        }
-      }
+bool Dsmr::parse_byte_(char c) {
+  // Find a new telegram header, i.e. forward slash.
+  if (c == '/') {
+    ESP_LOGV(TAG, "Header of telegram found");
+    this->reset_parser_();
+    this->header_found_ = true;
+  }
+  if (!this->header_found_)
+    return false;
+
+  // Check for buffer overflow.
+  if (this->bytes_read_ >= this->max_telegram_len_) {
+    this->reset_parser_();
+    ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+    return false;
+  }
+  this->bytes_read_++;
+
+  // Check for the end of the hex checksum, i.e. a newline.
+  if (this->footer_found_) {
+    if (c == '\n') {
+      this->finish_telegram_();
+      return true;
     }
+    if (c != '\r')
+      this->line_ += c;
+    return false;
+  }
 
-    // Store the byte in the buffer.
-    this->telegram_[this->bytes_read_] = c;
-    this->bytes_read_++;
+  // The checksum covers the telegram from the header up to and including the footer
+  this->crc_ = crc16(reinterpret_cast<const uint8_t *>(&c), 1, this->crc_);
 
-    // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
-    if (c == '!') {
-      ESP_LOGV(TAG, "Footer of telegram found");
-      this->footer_found_ = true;
-      continue;
+  if (c == '\r' || c == '\n') {
+    this->line_ended_ = !this->line_.empty();
+    return false;
+  }
+  // Some v2.2 or v3 meters will send a new value which starts with '('
+  // in a new line, while the value belongs to the previous ObisId. For
+  // proper parsing, append these to the previous line.
+  if (this->line_ended_ && c != '(' && !this->parse_line_())
+    return false;
+  this->line_ended_ = false;
+
+  // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
+  if (c == '!') {
+    ESP_LOGV(TAG, "Footer of telegram found");
+    if (!this->line_.empty() && !this->parse_line_())
+      return false;
+    this->footer_found_ = true;
+    return false;
+  }
+  // The header isn't part of the identification line
+  if (c != '/')
+    this->line_ += c;
+  return false;
+}
+
+bool Dsmr::parse_line_() {
+  const char *begin = this->line_.c_str();
+  const char *end = begin + this->line_.size();
+  ::dsmr::ParseResult<void> res;
+  if (!this->identification_parsed_) {
+    // The identification line has no OBIS id, the parser offers it with the all-ones id
+    res = this->data_.parse_line(::dsmr::ObisId(255, 255, 255, 255, 255, 255), begin, end);
+    this->identification_parsed_ = true;
+  } else {
+    // Ignore unknown values
+    res = ::dsmr::P1Parser::parse_line(&this->data_, begin, end, false);
+  }
+  if (res.err) {
+    // Parsing error, show it
+    auto err_str = res.fullError(begin, end);
+    ESP_LOGE(TAG, "%s", err_str.c_str());
+    this->reset_parser_();
+    return false;
+  }
+  this->line_.clear();
+  return true;
+}
+
+void Dsmr::finish_telegram_() {
+  ESP_LOGV(TAG, "Trying to parse telegram");
+  if (this->crc_check_) {
+    const char *begin = this->line_.c_str();
+    ::dsmr::ParseResult<uint16_t> res = ::dsmr::CrcParser::parse(begin, begin + this->line_.size());
+    if (res.err) {
+      auto err_str = res.fullError(begin, begin + this->line_.size());
+      ESP_LOGE(TAG, "%s", err_str.c_str());
+      this->reset_parser_();
+      return;
     }
-    // Check for the end of the hex checksum, i.e. a newline.
-    if (this->footer_found_ && c == '\n') {
-      // Parse the telegram and publish sensor values.
-      this->parse_telegram();
-      this->reset_telegram_();
+    if (res.result != this->crc_) {
+      ESP_LOGE(TAG, "Checksum mismatch: %04X != %04X", res.result, this->crc_);
+      this->reset_parser_();
       return;
     }
   }
+  this->status_clear_warning();
+  this->publish_sensors(this->data_);
+  this->reset_parser_();
 }
 
 void Dsmr::receive_encrypted_telegram_() {
   while (this->available_within_timeout_()) {
-    const char c = this->read();
+    const uint8_t c = this->read();
 
     // Find a new telegram start byte.
-    if (!this->header_found_) {
-      if ((uint8_t) c != 0xDB) {
+    if (this->crypt_bytes_read_ == 0) {
+      if (c != 0xDB) {
         continue;
       }
       ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
       this->reset_telegram_();
-      this->header_found_ = true;
     }
 
-    // Check for buffer overflow.
-    if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
+    if (this->crypt_bytes_read_ < CRYPT_HEADER_LEN) {
+      this->crypt_header_[this->crypt_bytes_read_++] = c;
+      if (this->crypt_bytes_read_ == 13) {
+        // Complete header + data bytes
+        this->crypt_telegram_len_ = 13 + (this->crypt_header_[11] << 8 | this->crypt_header_[12]);
+        ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+        // Check for buffer overflow.
+        if (this->crypt_telegram_len_ > this->max_telegram_len_) {
+          this->reset_telegram_();
+          ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+          return;
+        }
+      }
+      if (this->crypt_bytes_read_ == CRYPT_HEADER_LEN) {
+        this->gcmaes128_->setKey(this->decryption_key_.data(), this->gcmaes128_->keySize());
+        // the iv is 8 bytes of the system title + 4 bytes frame counter
+        // system title is at byte 2 and frame counter at byte 14
+        uint8_t iv[12];
+        memcpy(iv, &this->crypt_header_[2], 8);
+        memcpy(iv + 8, &this->crypt_header_[14], 4);
+        this->gcmaes128_->setIV(iv, sizeof(iv));
+      }
+      continue;
+    }
+
+    // The ciphertext starts at byte 18, decrypt it into the parser as it arrives
+    uint8_t plain;
+    this->gcmaes128_->decrypt(&plain, &c, 1);
+    if (this->crypt_bytes_read_ == CRYPT_HEADER_LEN && plain != '/') {
+      // A wrong key or a corrupted frame, don't search the garbage for a header
+      ESP_LOGE(TAG, "Decrypted telegram should start with /");
+      this->stop_requesting_data_();
       this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
       return;
     }
-
-    // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
     this->crypt_bytes_read_++;
-
-    // Read the length of the incoming encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
-      // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
-      ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
-    }
+    this->parse_byte_(plain);
 
     // Check for the end of the encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
+    if (this->crypt_bytes_read_ < this->crypt_telegram_len_) {
       continue;
     }
     ESP_LOGV(TAG, "End of encrypted telegram found");
-
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
-    // the iv is 8 bytes of the system title + 4 bytes frame counter
-    // system title is at byte 2 and frame counter at byte 15
-    for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
-    constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
-
-    // Parse the decrypted telegram and publish sensor values.
-    this->parse_telegram();
+    this->stop_requesting_data_();
     this->reset_telegram_();
     return;
   }
 }
 
-bool Dsmr::parse_telegram() {
-  MyData data;
-  ESP_LOGV(TAG, "Trying to parse telegram");
-  this->stop_requesting_data_();
-  ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
-                              this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
-  if (res.err) {
-    // Parsing error, show it
-    auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
-    ESP_LOGE(TAG, "%s", err_str.c_str());
-    return false;
-  } else {
-    this->status_clear_warning();
-    this->publish_sensors(data);
-    return true;
-  }
-}
-
 void Dsmr::dump_config() {
   ESP_LOGCONFIG(TAG, "DSMR:");
   ESP_LOGCONFIG(TAG, "  Max telegram length: %d", this->max_telegram_len_);
@@ -293,9 +333,9 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
   if (decryption_key.length() == 0) {
     ESP_LOGI(TAG, "Disabling decryption");
     this->decryption_key_.clear();
-    if (this->crypt_telegram_ != nullptr) {
-      delete[] this->crypt_telegram_;
-      this->crypt_telegram_ = nullptr;
+    if (this->gcmaes128_ != nullptr) {
+      delete this->gcmaes128_;  // NOLINT(cppcoreguidelines-owning-memory)
+      this->gcmaes128_ = nullptr;
     }
     return;
   }
@@ -316,8 +356,8 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
     this->decryption_key_.push_back(std::strtoul(temp, nullptr, 16));
   }
 
-  if (this->crypt_telegram_ == nullptr) {
-    this->crypt_telegram_ = new uint8_t[this->max_telegram_len_];  // NOLINT
+  if (this->gcmaes128_ == nullptr) {
+    this->gcmaes128_ = new GCM<AES128>();  // NOLINT
   }
 }
 
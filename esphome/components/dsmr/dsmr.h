@@ -13,6 +13,12 @@
 #include <dsmr/parser.h>
 #include <dsmr/fields.h>
 
+#include <AES.h>
+#include <Crypto.h>
+#include <GCM.h>
+
+#include <string>
+
 namespace esphome {
 namespace dsmr {
 
@@ -45,6 +51,12 @@ using namespace ::dsmr::fields;
 using MyData = ::dsmr::ParsedData<DSMR_TEXT_SENSOR_LIST(DSMR_DATA_SENSOR, DSMR_COMMA)
                                       DSMR_BOTH DSMR_SENSOR_LIST(DSMR_DATA_SENSOR, DSMR_COMMA)>;
 
+/** Reads the telegrams of a smart meter from its P1 port.
+ *
+ * Telegrams are parsed while they are received, one line at a time, so only the longest line is buffered. The
+ * checksum is updated with every byte, and the values are published once the footer confirms the telegram.
+ * Encrypted telegrams are decrypted byte by byte into the same parser.
+ */
 class Dsmr : public Component, public uart::UARTDevice {
  public:
   Dsmr(uart::UARTComponent *uart, bool crc_check) : uart::UARTDevice(uart), crc_check_(crc_check) {}
@@ -52,8 +64,6 @@ class Dsmr : public Component, public uart::UARTDevice {
   void setup() override;
   void loop() override;
 
-  bool parse_telegram();
-
   void publish_sensors(MyData &data) {
 #define DSMR_PUBLISH_SENSOR(s) \
   if (data.s##_present && this->s_##s##_ != nullptr) \
@@ -86,7 +96,16 @@ class Dsmr : public Component, public uart::UARTDevice {
  protected:
   void receive_telegram_();
   void receive_encrypted_telegram_();
+  /// Reset the state of the telegram and of the encrypted frame it is received in.
   void reset_telegram_();
+  /// Reset the state of the telegram, to wait for the next header.
+  void reset_parser_();
+  /// Parse the next byte of a telegram, returns true when the telegram is complete.
+  bool parse_byte_(char c);
+  /// Parse the data line in line_, returns false and resets the parser if it is invalid.
+  bool parse_line_();
+  /// Check the checksum after the footer and publish the values of a valid telegram.
+  void finish_telegram_();
 
   /// Wait for UART data to become available within the read timeout.
   ///
@@ -113,15 +132,27 @@ class Dsmr : public Component, public uart::UARTDevice {
   uint32_t receive_timeout_;
   bool receive_timeout_reached_();
   size_t max_telegram_len_;
-  char *telegram_{nullptr};
   size_t bytes_read_{0};
-  uint8_t *crypt_telegram_{nullptr};
-  size_t crypt_telegram_len_{0};
-  size_t crypt_bytes_read_{0};
   uint32_t last_read_time_{0};
   bool header_found_{false};
   bool footer_found_{false};
 
+  // Parse telegram
+  MyData data_;
+  /// The line being received, or the checksum once the footer was found.
+  std::string line_;
+  /// A line ended, it is parsed when the next line doesn't continue it.
+  bool line_ended_{false};
+  bool identification_parsed_{false};
+  uint16_t crc_{0};
+
+  // Decrypt telegram
+  static const size_t CRYPT_HEADER_LEN = 18;
+  GCM<AES128> *gcmaes128_{nullptr};
+  uint8_t crypt_header_[CRYPT_HEADER_LEN];
+  size_t crypt_telegram_len_{0};
+  size_t crypt_bytes_read_{0};
+
 // Sensor member pointers
 #define DSMR_DECLARE_SENSOR(s) sensor::Sensor *s_##s##_{nullptr};
   DSMR_SENSOR_LIST(DSMR_DECLARE_SENSOR, )
@@ -25,6 +25,7 @@ CONF_SCAN_PARAMETERS = "scan_parameters"
 CONF_WINDOW = "window"
 CONF_CONTINUOUS = "continuous"
 CONF_ON_SCAN_END = "on_scan_end"
+CONF_ADVERTISEMENT_QUEUE_SIZE = "advertisement_queue_size"
 esp32_ble_tracker_ns = cg.esphome_ns.namespace("esp32_ble_tracker")
 ESP32BLETracker = esp32_ble_tracker_ns.class_("ESP32BLETracker", cg.Component)
 ESPBTClient = esp32_ble_tracker_ns.class_("ESPBTClient")
@@ -137,6 +138,9 @@ def as_reversed_hex_array(value):
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(ESP32BLETracker),
+        cv.Optional(CONF_ADVERTISEMENT_QUEUE_SIZE, default=32): cv.int_range(
+            min=4, max=4096
+        ),
         cv.Optional(CONF_SCAN_PARAMETERS, default={}): cv.All(
             cv.Schema(
                 {
@@ -203,6 +207,7 @@ async def to_code(config):
     cg.add(var.set_scan_window(int(params[CONF_WINDOW].total_milliseconds / 0.625)))
     cg.add(var.set_scan_active(params[CONF_ACTIVE]))
     cg.add(var.set_scan_continuous(params[CONF_CONTINUOUS]))
+    cg.add(var.set_advertisement_queue_size(config[CONF_ADVERTISEMENT_QUEUE_SIZE]))
     for conf in config.get(CONF_ON_BLE_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         if CONF_MAC_ADDRESS in conf:
@@ -289,6 +294,9 @@ async def esp32_ble_tracker_stop_scan_action_to_code(
 async def register_ble_device(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    if CONF_MAC_ADDRESS in config:
+        # Devices matching on the address don't need to see any other device
+        cg.add(var.set_device_filter_address(config[CONF_MAC_ADDRESS].as_hex))
     return var
 
 
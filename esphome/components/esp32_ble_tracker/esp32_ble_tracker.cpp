@@ -49,7 +49,11 @@ float ESP32BLETracker::get_setup_priority() const { return setup_priority::BLUET
 
 void ESP32BLETracker::setup() {
   global_esp32_ble_tracker = this;
-  this->scan_result_lock_ = xSemaphoreCreateMutex();
+  if (!this->scan_results_.init(this->advertisement_queue_size_)) {
+    ESP_LOGE(TAG, "Could not allocate the advertisement queue");
+    this->mark_failed();
+    return;
+  }
   this->scan_end_lock_ = xSemaphoreCreateMutex();
   this->scanner_idle_ = true;
   if (!ESP32BLETracker::ble_setup()) {
@@ -104,60 +108,77 @@ void ESP32BLETracker::loop() {
     }
   }
 
-  if (xSemaphoreTake(this->scan_result_lock_, 5L / portTICK_PERIOD_MS)) {
-    uint32_t index = this->scan_result_index_;
-    xSemaphoreGive(this->scan_result_lock_);
+  this->process_scan_results_();
+  this->check_dropped_advertisements_();
 
-    if (index >= 16) {
-      ESP_LOGW(TAG, "Too many BLE events to process. Some devices may not show up.");
+  if (this->scan_set_param_failed_) {
+    ESP_LOGE(TAG, "Scan set param failed: %d", this->scan_set_param_failed_);
+    this->scan_set_param_failed_ = ESP_BT_STATUS_SUCCESS;
+  }
+
+  if (this->scan_start_failed_) {
+    ESP_LOGE(TAG, "Scan start failed: %d", this->scan_start_failed_);
+    this->scan_start_failed_ = ESP_BT_STATUS_SUCCESS;
+  }
+}
+
+void ESP32BLETracker::process_scan_results_() {
+  // At most one queue worth per loop, so that a busy producer can't keep the loop here
+  for (size_t i = 0; i < this->scan_results_.size(); i++) {
+    BLEScanResult *result = this->scan_results_.front();
+    if (result == nullptr)
+      break;
+    ESPBTDevice device;
+    device.parse_scan_rst(*result);
+    this->scan_results_.pop();
+
+    bool found = false;
+    for (auto *listener : this->listeners_) {
+      if (listener->matches_device_filter(device) && listener->parse_device(device))
+        found = true;
     }
-    for (size_t i = 0; i < index; i++) {
-      ESPBTDevice device;
-      device.parse_scan_rst(this->scan_result_buffer_[i]);
-
-      bool found = false;
-      for (auto *listener : this->listeners_) {
-        if (listener->parse_device(device))
-          found = true;
-      }
 
-      for (auto *client : this->clients_) {
-        if (client->parse_device(device)) {
-          found = true;
-          if (client->state() == ClientState::DISCOVERED) {
-            esp_ble_gap_stop_scanning();
+    for (auto *client : this->clients_) {
+      if (client->matches_device_filter(device) && client->parse_device(device)) {
+        found = true;
+        if (client->state() == ClientState::DISCOVERED) {
+          esp_ble_gap_stop_scanning();
 #ifdef USE_ARDUINO
-            constexpr TickType_t block_time = 10L / portTICK_PERIOD_MS;
+          constexpr TickType_t block_time = 10L / portTICK_PERIOD_MS;
 #else
-            constexpr TickType_t block_time = 0L;  // PR #3594
+          constexpr TickType_t block_time = 0L;  // PR #3594
 #endif
-            if (xSemaphoreTake(this->scan_end_lock_, block_time)) {
-              xSemaphoreGive(this->scan_end_lock_);
-            }
+          if (xSemaphoreTake(this->scan_end_lock_, block_time)) {
+            xSemaphoreGive(this->scan_end_lock_);
           }
         }
       }
-
-      if (!found) {
-        this->print_bt_device_info(device);
-      }
     }
 
-    if (xSemaphoreTake(this->scan_result_lock_, 10L / portTICK_PERIOD_MS)) {
-      this->scan_result_index_ = 0;
-      xSemaphoreGive(this->scan_result_lock_);
+    if (!found) {
+      this->print_bt_device_info(device);
     }
   }
+}
 
-  if (this->scan_set_param_failed_) {
-    ESP_LOGE(TAG, "Scan set param failed: %d", this->scan_set_param_failed_);
-    this->scan_set_param_failed_ = ESP_BT_STATUS_SUCCESS;
+void ESP32BLETracker::check_dropped_advertisements_() {
+  const uint32_t dropped = this->scan_results_.get_dropped();
+  if (dropped != this->dropped_advertisements_) {
+    ESP_LOGW(TAG, "Advertisement queue full, dropped %u advertisements. Some devices may not show up.",
+             dropped - this->dropped_advertisements_);
+    this->dropped_advertisements_ = dropped;
   }
-
-  if (this->scan_start_failed_) {
-    ESP_LOGE(TAG, "Scan start failed: %d", this->scan_start_failed_);
-    this->scan_start_failed_ = ESP_BT_STATUS_SUCCESS;
+#ifdef USE_SENSOR
+  if (this->dropped_advertisements_sensor_ != nullptr) {
+    const uint32_t now = millis();
+    if ((!this->dropped_advertisements_sensor_->has_state() ||
+         this->dropped_advertisements_sensor_->get_raw_state() != dropped) &&
+        now - this->dropped_advertisements_published_at_ >= 1000) {
+      this->dropped_advertisements_published_at_ = now;
+      this->dropped_advertisements_sensor_->publish_state(dropped);
+    }
   }
+#endif
 }
 
 void ESP32BLETracker::start_scan() {
@@ -305,6 +326,10 @@ void ESP32BLETracker::register_client(ESPBTClient *client) {
 }
 
 void ESP32BLETracker::gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
+  if (event == ESP_GAP_BLE_SCAN_RESULT_EVT && param->scan_rst.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
+    global_esp32_ble_tracker->gap_scan_result_(param->scan_rst);
+    return;
+  }
   BLEEvent *gap_event = new BLEEvent(event, param);  // NOLINT(cppcoreguidelines-owning-memory)
   global_esp32_ble_tracker->ble_events_.push(gap_event);
 }  // NOLINT(clang-analyzer-cplusplus.NewDeleteLeaks)
@@ -345,12 +370,18 @@ void ESP32BLETracker::gap_scan_stop_complete_(const esp_ble_gap_cb_param_t::ble_
 
 void ESP32BLETracker::gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
   if (param.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
-    if (xSemaphoreTake(this->scan_result_lock_, 0L)) {
-      if (this->scan_result_index_ < 16) {
-        this->scan_result_buffer_[this->scan_result_index_++] = param;
-      }
-      xSemaphoreGive(this->scan_result_lock_);
-    }
+    // Runs in the Bluetooth task, the only producer of scan_results_
+    BLEScanResult *result = this->scan_results_.write_slot();
+    if (result == nullptr)
+      return;
+    memcpy(result->bda, param.bda, sizeof(result->bda));
+    result->ble_addr_type = param.ble_addr_type;
+    result->rssi = param.rssi;
+    result->adv_data_len = param.adv_data_len;
+    result->scan_rsp_len = param.scan_rsp_len;
+    memcpy(result->ble_adv, param.ble_adv, param.adv_data_len + param.scan_rsp_len);
+    result->timestamp = millis();
+    this->scan_results_.push_slot();
   } else if (param.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT) {
     xSemaphoreGive(this->scan_end_lock_);
   }
@@ -563,15 +594,15 @@ optional<ESPBLEiBeacon> ESPBLEiBeacon::from_manufacturer_data(const ServiceData
   return ESPBLEiBeacon(data.data.data());
 }
 
-void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
+void ESPBTDevice::parse_scan_rst(const BLEScanResult &param) {
   this->scan_result_ = param;
   for (uint8_t i = 0; i < ESP_BD_ADDR_LEN; i++)
     this->address_[i] = param.bda[i];
   this->address_type_ = param.ble_addr_type;
   this->rssi_ = param.rssi;
-  this->parse_adv_(param);
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+  this->ensure_adv_parsed_();
   ESP_LOGVV(TAG, "Parse Result:");
   const char *address_type = "";
   switch (this->address_type_) {
@@ -625,21 +656,87 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
   ESP_LOGVV(TAG, "Adv data: %s", format_hex_pretty(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
 #endif
 }
-void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
-  size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
+void ESPBTDevice::index_adv_() const {
+  this->adv_indexed_ = true;
+  this->adv_field_count_ = 0;
+  const uint8_t *payload = this->scan_result_.ble_adv;
+  const size_t len = this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len;
 
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0)
+  size_t offset = 0;
+  while (offset + 2 < len && this->adv_field_count_ < MAX_ADV_FIELDS) {
+    const uint8_t field_length = payload[offset];  // First byte is length of adv record
+    // A field that doesn't fit is truncated, ignore it and everything after it
+    if (field_length == 0 || offset + 1 + field_length > len)
       break;
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
+    this->adv_field_offsets_[this->adv_field_count_++] = offset;
+    offset += 1 + field_length;
+  }
+}
+ESPBTAdvField ESPBTDevice::get_adv_field(uint8_t index) const {
+  this->ensure_adv_indexed_();
+  const uint8_t *field = &this->scan_result_.ble_adv[this->adv_field_offsets_[index]];
+  // The length includes the type byte
+  return ESPBTAdvField{field[1], field + 2, uint8_t(field[0] - 1)};
+}
+bool ESPBTDevice::has_service_uuid(const ESPBTUUID &uuid) const {
+  for (uint8_t i = 0; i < this->get_adv_field_count(); i++) {
+    const ESPBTAdvField field = this->get_adv_field(i);
+    switch (field.type) {
+      case ESP_BLE_AD_TYPE_16SRV_CMPL:
+      case ESP_BLE_AD_TYPE_16SRV_PART:
+        for (uint8_t j = 0; j + 2 <= field.length; j += 2) {
+          if (ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(field.data + j)) == uuid)
+            return true;
+        }
+        break;
+      case ESP_BLE_AD_TYPE_32SRV_CMPL:
+      case ESP_BLE_AD_TYPE_32SRV_PART:
+        for (uint8_t j = 0; j + 4 <= field.length; j += 4) {
+          if (ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(field.data + j)) == uuid)
+            return true;
+        }
+        break;
+      case ESP_BLE_AD_TYPE_128SRV_CMPL:
+      case ESP_BLE_AD_TYPE_128SRV_PART:
+        for (uint8_t j = 0; j + 16 <= field.length; j += 16) {
+          if (ESPBTUUID::from_raw(field.data + j) == uuid)
+            return true;
+        }
+        break;
+      case ESP_BLE_AD_TYPE_SERVICE_DATA:
+        if (field.length >= 2 && ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(field.data)) == uuid)
+          return true;
+        break;
+      case ESP_BLE_AD_TYPE_32SERVICE_DATA:
+        if (field.length >= 4 && ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(field.data)) == uuid)
+          return true;
+        break;
+      case ESP_BLE_AD_TYPE_128SERVICE_DATA:
+        if (field.length >= 16 && ESPBTUUID::from_raw(field.data) == uuid)
+          return true;
+        break;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+bool ESPBTDevice::has_manufacturer_id(uint16_t manufacturer_id) const {
+  for (uint8_t i = 0; i < this->get_adv_field_count(); i++) {
+    const ESPBTAdvField field = this->get_adv_field(i);
+    if (field.type == ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE && field.length >= 2 &&
+        *reinterpret_cast<const uint16_t *>(field.data) == manufacturer_id)
+      return true;
+  }
+  return false;
+}
+void ESPBTDevice::parse_adv_() const {
+  this->adv_parsed_ = true;
+  for (uint8_t i = 0; i < this->get_adv_field_count(); i++) {
+    const ESPBTAdvField field = this->get_adv_field(i);
+    const uint8_t record_type = field.type;
+    const uint8_t *record = field.data;
+    const uint8_t record_length = field.length;
 
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
@@ -665,7 +762,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        this->tx_powers_.push_back(*record);
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -789,6 +886,22 @@ std::string ESPBTDevice::address_str() const {
 }
 uint64_t ESPBTDevice::address_uint64() const { return ble_addr_to_uint64(this->address_); }
 
+bool ESPBTDeviceListener::matches_device_filter(const ESPBTDevice &device) const {
+  if (this->filter_address_ != 0 && device.address_uint64() != this->filter_address_)
+    return false;
+  if (this->filter_service_uuids_.empty() && this->filter_manufacturer_ids_.empty())
+    return true;
+  for (auto &uuid : this->filter_service_uuids_) {
+    if (device.has_service_uuid(uuid))
+      return true;
+  }
+  for (auto manufacturer_id : this->filter_manufacturer_ids_) {
+    if (device.has_manufacturer_id(manufacturer_id))
+      return true;
+  }
+  return false;
+}
+
 void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "BLE Tracker:");
   ESP_LOGCONFIG(TAG, "  Scan Duration: %u s", this->scan_duration_);
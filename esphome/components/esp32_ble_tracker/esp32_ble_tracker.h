@@ -3,8 +3,13 @@
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/defines.h"
 #include "queue.h"
 
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
 #ifdef USE_ESP32
 
 #include <string>
@@ -77,9 +82,31 @@ class ESPBLEiBeacon {
   } PACKED beacon_data_;
 };
 
+/// The parts of a scan result the tracker uses, queued from the Bluetooth task to the main loop.
+struct BLEScanResult {
+  esp_bd_addr_t bda;
+  esp_ble_addr_type_t ble_addr_type;
+  int8_t rssi;
+  uint8_t adv_data_len;
+  uint8_t scan_rsp_len;
+  uint8_t ble_adv[ESP_BLE_ADV_DATA_LEN_MAX + ESP_BLE_SCAN_RSP_DATA_LEN_MAX];
+  /// millis() when the Bluetooth stack reported the advertisement
+  uint32_t timestamp;
+};
+
+/// A field (AD structure) of an advertisement, pointing into the raw data of the scan result.
+struct ESPBTAdvField {
+  uint8_t type;
+  const uint8_t *data;
+  uint8_t length;
+};
+
+/// A scan result. Only the address and RSSI are read when it is created, the fields of the advertisement are indexed
+/// and parsed the first time a listener asks for them, so that listeners that only look at the address don't pay for
+/// parsing every advertisement.
 class ESPBTDevice {
  public:
-  void parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  void parse_scan_rst(const BLEScanResult &param);
 
   std::string address_str() const;
 
@@ -89,22 +116,57 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
+  /// millis() when the advertisement was received, it can be a few loop iterations older than its processing.
+  uint32_t get_timestamp() const { return this->scan_result_.timestamp; }
+  const std::string &get_name() const {
+    this->ensure_adv_parsed_();
+    return this->name_;
+  }
+
+  const std::vector<int8_t> &get_tx_powers() const {
+    this->ensure_adv_parsed_();
+    return tx_powers_;
+  }
+
+  const optional<uint16_t> &get_appearance() const {
+    this->ensure_adv_parsed_();
+    return appearance_;
+  }
+  const optional<uint8_t> &get_ad_flag() const {
+    this->ensure_adv_parsed_();
+    return ad_flag_;
+  }
+  const std::vector<ESPBTUUID> &get_service_uuids() const {
+    this->ensure_adv_parsed_();
+    return service_uuids_;
+  }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  const std::vector<ServiceData> &get_manufacturer_datas() const {
+    this->ensure_adv_parsed_();
+    return manufacturer_datas_;
+  }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const std::vector<ServiceData> &get_service_datas() const {
+    this->ensure_adv_parsed_();
+    return service_datas_;
+  }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  const BLEScanResult &get_scan_result() const { return scan_result_; }
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  /// The fields of the advertisement and scan response, without copying or parsing their data.
+  uint8_t get_adv_field_count() const {
+    this->ensure_adv_indexed_();
+    return this->adv_field_count_;
+  }
+  ESPBTAdvField get_adv_field(uint8_t index) const;
 
-  const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &get_scan_result() const { return scan_result_; }
+  /// Whether the service is in one of the service UUID lists or has service data, without parsing the advertisement.
+  bool has_service_uuid(const ESPBTUUID &uuid) const;
+  /// Whether there is manufacturer data with this company id, without parsing the advertisement.
+  bool has_manufacturer_id(uint16_t manufacturer_id) const;
 
   optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
+    for (auto &it : this->get_manufacturer_datas()) {
       auto res = ESPBLEiBeacon::from_manufacturer_data(it);
       if (res.has_value())
         return *res;
@@ -113,21 +175,39 @@ class ESPBTDevice {
   }
 
  protected:
-  void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Every field is at least a length and a type byte
+  static const uint8_t MAX_ADV_FIELDS = (ESP_BLE_ADV_DATA_LEN_MAX + ESP_BLE_SCAN_RSP_DATA_LEN_MAX) / 2;
+
+  void ensure_adv_indexed_() const {
+    if (!this->adv_indexed_)
+      this->index_adv_();
+  }
+  void ensure_adv_parsed_() const {
+    if (!this->adv_parsed_)
+      this->parse_adv_();
+  }
+  /// Find the fields of the advertisement in a single pass over the raw data.
+  void index_adv_() const;
+  void parse_adv_() const;
 
   esp_bd_addr_t address_{
       0,
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_;
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
-  esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_{};
+  mutable std::string name_{};
+  mutable std::vector<int8_t> tx_powers_{};
+  mutable optional<uint16_t> appearance_{};
+  mutable optional<uint8_t> ad_flag_{};
+  mutable std::vector<ESPBTUUID> service_uuids_;
+  mutable std::vector<ServiceData> manufacturer_datas_{};
+  mutable std::vector<ServiceData> service_datas_{};
+  BLEScanResult scan_result_{};
+  /// Offsets of the length byte of each field in scan_result_.ble_adv
+  mutable uint8_t adv_field_offsets_[MAX_ADV_FIELDS];
+  mutable uint8_t adv_field_count_{0};
+  mutable bool adv_indexed_{false};
+  mutable bool adv_parsed_{false};
 };
 
 class ESP32BLETracker;
@@ -138,8 +218,21 @@ class ESPBTDeviceListener {
   virtual bool parse_device(const ESPBTDevice &device) = 0;
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
+  /// Only pass devices with this address to parse_device().
+  void set_device_filter_address(uint64_t address) { this->filter_address_ = address; }
+  /// Only pass devices advertising one of the service UUIDs or manufacturer ids added here to parse_device().
+  void add_device_filter_service_uuid(const ESPBTUUID &uuid) { this->filter_service_uuids_.push_back(uuid); }
+  void add_device_filter_manufacturer_id(uint16_t manufacturer_id) {
+    this->filter_manufacturer_ids_.push_back(manufacturer_id);
+  }
+  /// Whether the device passes the filters, checked by the tracker before calling parse_device().
+  bool matches_device_filter(const ESPBTDevice &device) const;
+
  protected:
   ESP32BLETracker *parent_{nullptr};
+  uint64_t filter_address_{0};
+  std::vector<ESPBTUUID> filter_service_uuids_;
+  std::vector<uint16_t> filter_manufacturer_ids_;
 };
 
 enum class ClientState {
@@ -176,6 +269,12 @@ class ESP32BLETracker : public Component {
   void set_scan_window(uint32_t scan_window) { scan_window_ = scan_window; }
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+  void set_advertisement_queue_size(size_t advertisement_queue_size) {
+    this->advertisement_queue_size_ = advertisement_queue_size;
+  }
+#ifdef USE_SENSOR
+  void set_dropped_advertisements_sensor(sensor::Sensor *sensor) { this->dropped_advertisements_sensor_ = sensor; }
+#endif
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -206,8 +305,13 @@ class ESP32BLETracker : public Component {
   /// Callback that will handle all GAP events and redistribute them to other callbacks.
   static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param);
   void real_gap_event_handler_(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param);
-  /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received.
+  /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received. Results are queued from the Bluetooth task
+  /// directly, the end of the scan goes through the event queue.
   void gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Pass the queued advertisements to the listeners and clients.
+  void process_scan_results_();
+  /// Warn about and report advertisements dropped because the queue was full.
+  void check_dropped_advertisements_();
   /// Called when a `ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT` event is received.
   void gap_scan_set_param_complete_(const esp_ble_gap_cb_param_t::ble_scan_param_cmpl_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_START_COMPLETE_EVT` event is received.
@@ -234,10 +338,15 @@ class ESP32BLETracker : public Component {
   bool scan_continuous_;
   bool scan_active_;
   bool scanner_idle_;
-  SemaphoreHandle_t scan_result_lock_;
   SemaphoreHandle_t scan_end_lock_;
-  size_t scan_result_index_{0};
-  esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_buffer_[16];
+  /// Scan results from the Bluetooth task, without locking or allocating per advertisement
+  RingQueue<BLEScanResult> scan_results_;
+  size_t advertisement_queue_size_{32};
+  uint32_t dropped_advertisements_{0};
+#ifdef USE_SENSOR
+  sensor::Sensor *dropped_advertisements_sensor_{nullptr};
+  uint32_t dropped_advertisements_published_at_{0};
+#endif
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
 
@@ -4,6 +4,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 
+#include <atomic>
 #include <queue>
 #include <mutex>
 #include <cstring>
@@ -55,6 +56,59 @@ template<class T> class Queue {
   SemaphoreHandle_t m_;
 };
 
+/// Fixed size ring between one producer and one consumer task, without locks. The producer writes into the next free
+/// slot in place and drops the element when the ring is full, the drops are counted.
+template<class T> class RingQueue {
+ public:
+  /// Allocate the slots, in external RAM when available. Returns false when the allocation failed.
+  bool init(size_t size) {
+    // One slot always stays empty to tell a full ring from an empty one
+    this->capacity_ = size + 1;
+    ExternalRAMAllocator<T> allocator(ExternalRAMAllocator<T>::ALLOW_FAILURE);
+    this->buffer_ = allocator.allocate(this->capacity_);
+    return this->buffer_ != nullptr;
+  }
+
+  /// Producer: the slot to write the next element to, or nullptr when the ring is full.
+  T *write_slot() {
+    const size_t head = this->head_.load(std::memory_order_relaxed);
+    if ((head + 1) % this->capacity_ == this->tail_.load(std::memory_order_acquire)) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    return &this->buffer_[head];
+  }
+  /// Producer: publish the element written to write_slot() to the consumer.
+  void push_slot() {
+    const size_t head = this->head_.load(std::memory_order_relaxed);
+    this->head_.store((head + 1) % this->capacity_, std::memory_order_release);
+  }
+
+  /// Consumer: the oldest element, or nullptr when the ring is empty.
+  T *front() {
+    const size_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return nullptr;
+    return &this->buffer_[tail];
+  }
+  /// Consumer: release the slot of front() to the producer.
+  void pop() {
+    const size_t tail = this->tail_.load(std::memory_order_relaxed);
+    this->tail_.store((tail + 1) % this->capacity_, std::memory_order_release);
+  }
+
+  size_t size() const { return this->capacity_ - 1; }
+  /// Number of elements dropped because the ring was full.
+  uint32_t get_dropped() const { return this->dropped_.load(std::memory_order_relaxed); }
+
+ protected:
+  T *buffer_{nullptr};
+  size_t capacity_{1};
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
 // Received GAP and GATTC events are only queued, and get processed in the main loop().
 // This class stores each event in a single type.
 class BLEEvent {
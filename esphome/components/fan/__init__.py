@@ -22,7 +22,7 @@ from esphome.const import (
     CONF_RESTORE_MODE,
 )
 from esphome.core import CORE, coroutine_with_priority
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import register_entity_key, setup_entity
 
 IS_PLATFORM_COMPONENT = True
 
@@ -159,6 +159,7 @@ async def register_fan(var, config):
     if not CORE.has_id(config[CONF_ID]):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_fan(var))
+    register_entity_key("fan", config)
     await setup_fan_core_(var, config)
 
 
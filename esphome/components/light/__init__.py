@@ -20,7 +20,7 @@ from esphome.const import (
     CONF_WARM_WHITE_COLOR_TEMPERATURE,
 )
 from esphome.core import coroutine_with_priority
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import register_entity_key, setup_entity
 from .automation import light_control_to_code  # noqa
 from .effects import (
     validate_effects,
@@ -179,6 +179,7 @@ async def setup_light_core_(light_var, output_var, config):
 async def register_light(output_var, config):
     light_var = cg.new_Pvariable(config[CONF_ID], output_var)
     cg.add(cg.App.register_light(light_var))
+    register_entity_key("light", config)
     await cg.register_component(light_var, config)
     await setup_light_core_(light_var, output_var, config)
 
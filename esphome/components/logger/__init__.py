@@ -18,7 +18,7 @@ from esphome.const import (
     CONF_TRIGGER_ID,
     CONF_TX_BUFFER_SIZE,
 )
-from esphome.core import CORE, EsphomeError, Lambda, coroutine_with_priority
+from esphome.core import CORE, Lambda, coroutine_with_priority
 from esphome.components.esp32 import add_idf_sdkconfig_option, get_esp32_variant
 from esphome.components.esp32.const import (
     VARIANT_ESP32,
@@ -113,14 +113,16 @@ def uart_selection(value):
     raise NotImplementedError
 
 
-def validate_local_no_higher_than_global(value):
-    global_level = value.get(CONF_LEVEL, "DEBUG")
-    for tag, level in value.get(CONF_LOGS, {}).items():
-        if LOG_LEVEL_SEVERITY.index(level) > LOG_LEVEL_SEVERITY.index(global_level):
-            raise EsphomeError(
-                f"The local log level {level} for {tag} must be less severe than the global log level {global_level}."
-            )
-    return value
+def get_compiled_log_level(config):
+    """Return the log level messages are compiled in for.
+
+    This is the global level, unless a tag is explicitly raised above it with a local override.
+    In that case the higher level is compiled in and the global level is only applied at runtime.
+    """
+    return max(
+        [config[CONF_LEVEL], *config[CONF_LOGS].values()],
+        key=LOG_LEVEL_SEVERITY.index,
+    )
 
 
 Logger = logger_ns.class_("Logger", cg.Component)
@@ -155,7 +157,6 @@ CONFIG_SCHEMA = cv.All(
             ): cv.All(cv.only_on_esp8266, cv.boolean),
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    validate_local_no_higher_than_global,
 )
 
 
@@ -175,9 +176,12 @@ async def to_code(config):
         cg.add(log.set_log_level(tag, LOG_LEVELS[level]))
 
     level = config[CONF_LEVEL]
+    compiled_level = get_compiled_log_level(config)
     cg.add_define("USE_LOGGER")
     this_severity = LOG_LEVEL_SEVERITY.index(level)
-    cg.add_build_flag(f"-DESPHOME_LOG_LEVEL={LOG_LEVELS[level]}")
+    cg.add_build_flag(f"-DESPHOME_LOG_LEVEL={LOG_LEVELS[compiled_level]}")
+    if compiled_level != level:
+        cg.add(log.set_default_level(LOG_LEVELS[level]))
 
     verbose_severity = LOG_LEVEL_SEVERITY.index("VERBOSE")
     very_verbose_severity = LOG_LEVEL_SEVERITY.index("VERY_VERBOSE")
@@ -11,6 +11,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace logger {
 
@@ -53,6 +55,7 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
     return;
 
   recursion_guard_ = true;
+  this->call_raw_log_callbacks_(level, tag, line, format, args);
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
@@ -81,6 +84,7 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 
   // length of format string, includes null terminator
   uint32_t offset = this->tx_buffer_at_;
+  this->call_raw_log_callbacks_(level, tag, line, this->tx_buffer_, args);
 
   // now apply vsnprintf
   this->write_header_(level, tag, line);
@@ -91,16 +95,51 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 }
 #endif
 
+void HOT Logger::call_raw_log_callbacks_(int level, const char *tag, int line, const char *format, va_list args) {
+  for (auto &callback : this->raw_log_callbacks_) {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    callback(level, tag, line, format, args_copy);
+    va_end(args_copy);
+  }
+}
+
 int HOT Logger::level_for(const char *tag) {
-  // Uses std::vector<> for low memory footprint, though the vector
-  // could be sorted to minimize lookup times. This feature isn't used that
-  // much anyway so it doesn't matter too much.
-  for (auto &it : this->log_levels_) {
-    if (it.tag == tag) {
-      return it.level;
-    }
+  if (this->log_levels_.empty())
+    return this->default_level_;
+
+  // Tags are static strings, so the address identifies the tag and we only need to hash it the first time it is seen.
+  // Messages can be logged from other tasks, so the tag and its level are kept in a single word: the bits of the
+  // address that select the slot are the same for all tags in it, and hold the level instead.
+  auto address = reinterpret_cast<uintptr_t>(tag);
+  auto &entry = this->tag_level_cache_[(address >> 2) % TAG_LEVEL_CACHE_SIZE];
+  uintptr_t cached = entry.load(std::memory_order_relaxed);
+  if (cached != 0 && (cached & ~TAG_LEVEL_CACHE_MASK) == (address & ~TAG_LEVEL_CACHE_MASK))
+    return static_cast<int>((cached & TAG_LEVEL_CACHE_MASK) >> 2);
+
+  int level = this->lookup_level_(tag);
+  if (level >= ESPHOME_LOG_LEVEL_NONE && level <= ESPHOME_LOG_LEVEL_VERY_VERBOSE)
+    entry.store((address & ~TAG_LEVEL_CACHE_MASK) | (static_cast<uintptr_t>(level) << 2), std::memory_order_relaxed);
+  return level;
+}
+int Logger::lookup_level_(const char *tag) const {
+  uint32_t hash = fnv1_hash(tag);
+  auto it = std::lower_bound(this->log_levels_.begin(), this->log_levels_.end(), hash,
+                             [](const LogLevelOverride &o, uint32_t h) { return o.tag_hash < h; });
+  for (; it != this->log_levels_.end() && it->tag_hash == hash; it++) {
+    if (it->tag == tag)
+      return it->level;
   }
-  return ESPHOME_LOG_LEVEL;
+  return this->default_level_;
+}
+void Logger::update_max_level_() {
+  int max_level = this->default_level_;
+  for (auto &it : this->log_levels_)
+    max_level = std::max(max_level, it.level);
+  esp_log_level_max_ = std::min(max_level, ESPHOME_LOG_LEVEL);
+  // Overrides changed, forget previously resolved tags
+  for (auto &entry : this->tag_level_cache_)
+    entry.store(0, std::memory_order_relaxed);
 }
 void HOT Logger::log_message_(int level, const char *tag, int offset) {
   // remove trailing newline
@@ -243,12 +282,23 @@ void Logger::pre_setup() {
 }
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
-  this->log_levels_.push_back(LogLevelOverride{tag, log_level});
+  uint32_t hash = fnv1_hash(tag);
+  auto it = std::upper_bound(this->log_levels_.begin(), this->log_levels_.end(), hash,
+                             [](uint32_t h, const LogLevelOverride &o) { return h < o.tag_hash; });
+  this->log_levels_.insert(it, LogLevelOverride{hash, tag, log_level});
+  this->update_max_level_();
+}
+void Logger::set_default_level(int log_level) {
+  this->default_level_ = log_level;
+  this->update_max_level_();
 }
 UARTSelection Logger::get_uart() const { return this->uart_; }
 void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
   this->log_callback_.add(std::move(callback));
 }
+void Logger::add_on_raw_log_callback(std::function<void(int, const char *, int, const char *, va_list)> &&callback) {
+  this->raw_log_callbacks_.push_back(std::move(callback));
+}
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
 const char *const LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 #ifdef USE_ESP32
@@ -275,7 +325,7 @@ const char *const UART_SELECTIONS[] = {"UART0", "UART1"};
 #endif  // USE_ESP8266
 void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "Logger:");
-  ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
+  ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[this->default_level_]);
   ESP_LOGCONFIG(TAG, "  Log Baud Rate: %u", this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
   for (auto &it : this->log_levels_) {
@@ -4,6 +4,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
+#include <atomic>
 #include <cstdarg>
 
 #ifdef USE_ARDUINO
@@ -69,6 +70,9 @@ class Logger : public Component {
 
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
+  /// Set the log level for tags without an override, must not be higher than ESPHOME_LOG_LEVEL.
+  void set_default_level(int log_level);
+  int get_default_level() const { return this->default_level_; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -76,10 +80,21 @@ class Logger : public Component {
   void pre_setup();
   void dump_config() override;
 
+  /** Get the log level for the specified tag.
+   *
+   * Tags must be static strings (like the TAG constant of each component), resolved levels are cached by the address
+   * of the tag. A tag in a buffer that is reused for another tag can get the level of the tag that was there before.
+   */
   int level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
   void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  /** Register a callback that will be called with the unformatted arguments of every log message.
+   *
+   * The callback receives level, tag, line, format string and the printf arguments, it is called before the message
+   * is formatted for the other log outputs.
+   */
+  void add_on_raw_log_callback(std::function<void(int, const char *, int, const char *, va_list)> &&callback);
 
   float get_setup_priority() const override;
 
@@ -89,6 +104,10 @@ class Logger : public Component {
 #endif
 
  protected:
+  int lookup_level_(const char *tag) const;
+  void update_max_level_();
+
+  void call_raw_log_callbacks_(int level, const char *tag, int line, const char *format, va_list args);
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
@@ -142,12 +161,22 @@ class Logger : public Component {
 #ifdef USE_ESP_IDF
   uart_port_t uart_num_;
 #endif
+  int default_level_{ESPHOME_LOG_LEVEL};
   struct LogLevelOverride {
+    uint32_t tag_hash;
     std::string tag;
     int level;
   };
+  /// Per-tag overrides, sorted by tag_hash for binary search.
   std::vector<LogLevelOverride> log_levels_;
+  /// Resolved levels by tag address. The bits of the address that select the slot hold the level instead, so that the
+  /// tag and its level are published together in one word, see level_for().
+  static const size_t TAG_LEVEL_CACHE_SIZE = 16;
+  static const uintptr_t TAG_LEVEL_CACHE_MASK = (TAG_LEVEL_CACHE_SIZE - 1) << 2;
+  std::atomic<uintptr_t> tag_level_cache_[TAG_LEVEL_CACHE_SIZE]{};
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+  // Not a CallbackManager, each callback needs its own copy of the va_list
+  std::vector<std::function<void(int, const char *, int, const char *, va_list)>> raw_log_callbacks_;
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
 };
@@ -6,7 +6,7 @@ from esphome.automation import maybe_simple_id
 from esphome.const import CONF_ID, CONF_ON_STATE, CONF_TRIGGER_ID
 from esphome.core import CORE
 from esphome.coroutine import coroutine_with_priority
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import register_entity_key, setup_entity
 
 
 CODEOWNERS = ["@jesserockz"]
@@ -77,6 +77,7 @@ async def register_media_player(var, config):
     if not CORE.has_id(config[CONF_ID]):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_media_player(var))
+    register_entity_key("media_player", config)
     await setup_media_player_core_(var, config)
 
 
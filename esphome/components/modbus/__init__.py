@@ -1,22 +1,24 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.cpp_helpers import gpio_pin_expression
-from esphome.components import uart
+from esphome.components import modbus_base, uart
 from esphome.const import (
     CONF_FLOW_CONTROL_PIN,
     CONF_ID,
-    CONF_ADDRESS,
 )
 from esphome import pins
 
 DEPENDENCIES = ["uart"]
+AUTO_LOAD = ["modbus_base"]
 
-modbus_ns = cg.esphome_ns.namespace("modbus")
-Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice)
-ModbusDevice = modbus_ns.class_("ModbusDevice")
+modbus_ns = modbus_base.modbus_ns
+Modbus = modbus_ns.class_(
+    "Modbus", modbus_base.ModbusTransport, cg.Component, uart.UARTDevice
+)
+ModbusDevice = modbus_base.ModbusDevice
 MULTI_CONF = True
 
-CONF_MODBUS_ID = "modbus_id"
+CONF_MODBUS_ID = modbus_base.CONF_MODBUS_ID
 CONF_SEND_WAIT_TIME = "send_wait_time"
 
 CONFIG_SCHEMA = (
@@ -35,7 +37,6 @@ CONFIG_SCHEMA = (
 
 
 async def to_code(config):
-    cg.add_global(modbus_ns.using)
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
@@ -49,19 +50,6 @@ async def to_code(config):
         cg.add(var.set_send_wait_time(config[CONF_SEND_WAIT_TIME]))
 
 
-def modbus_device_schema(default_address):
-    schema = {
-        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(Modbus),
-    }
-    if default_address is None:
-        schema[cv.Required(CONF_ADDRESS)] = cv.hex_uint8_t
-    else:
-        schema[cv.Optional(CONF_ADDRESS, default=default_address)] = cv.hex_uint8_t
-    return cv.Schema(schema)
-
-
-async def register_modbus_device(var, config):
-    parent = await cg.get_variable(config[CONF_MODBUS_ID])
-    cg.add(var.set_parent(parent))
-    cg.add(var.set_address(config[CONF_ADDRESS]))
-    cg.add(parent.register_device(var))
+# The device helpers live in modbus_base, kept here for the devices on a Modbus RTU bus
+modbus_device_schema = modbus_base.modbus_device_schema
+register_modbus_device = modbus_base.register_modbus_device
@@ -11,6 +11,14 @@ void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+  // A character takes 11 bits on the line: start bit, 8 data bits, parity or a second stop bit and stop bit. Above
+  // 19200 baud the specification fixes the silence between frames at 1750us.
+  uint32_t baud_rate = this->parent_->get_baud_rate();
+  if (baud_rate > 19200) {
+    this->frame_delay_us_ = 1750;
+  } else {
+    this->frame_delay_us_ = 38500000UL / baud_rate;
+  }
 }
 void Modbus::loop() {
   const uint32_t now = millis();
@@ -20,24 +28,96 @@ void Modbus::loop() {
     this->last_modbus_byte_ = now;
   }
   // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
-  if (now - this->last_send_ > send_wait_time_) {
+  if (waiting_for_response != 0 && now - this->last_send_ > send_wait_time_) {
+    ESP_LOGV(TAG, "No response from address 0x%02X", waiting_for_response);
     waiting_for_response = 0;
+    this->current_device_ = nullptr;
+    this->on_timeout_();
   }
 
   while (this->available()) {
     uint8_t byte;
     this->read_byte(&byte);
+    this->last_frame_us_ = micros();
     if (this->parse_modbus_byte_(byte)) {
       this->last_modbus_byte_ = now;
     } else {
       this->rx_buffer_.clear();
     }
   }
+
+  if (waiting_for_response == 0)
+    this->send_next_();
+}
+
+void Modbus::send_next_() {
+  if (micros() - this->last_frame_us_ < this->frame_delay_us_)
+    return;
+
+  // Writes go first, so that switching something doesn't wait for the polling of all devices
+  ModbusDevice *sender = nullptr;
+  for (auto *device : this->devices_) {
+    if (device->send_next_command(true)) {
+      sender = device;
+      break;
+    }
+  }
+  for (size_t i = 0; sender == nullptr && i < this->devices_.size(); i++) {
+    auto *device = this->devices_[(this->next_device_ + i) % this->devices_.size()];
+    if (device->send_next_command(false)) {
+      sender = device;
+      this->next_device_ = (this->next_device_ + i + 1) % this->devices_.size();
+    }
+  }
+
+  if (sender != nullptr) {
+    this->current_device_ = sender;
+    if (!this->in_cycle_) {
+      this->in_cycle_ = true;
+      this->cycle_start_ = millis();
+      this->high_freq_.start();
+    }
+    return;
+  }
+
+  if (!this->in_cycle_)
+    return;
+  for (auto *device : this->devices_) {
+    // Requests held back by a command throttle are still part of this cycle
+    if (device->has_pending_commands())
+      return;
+  }
+  this->in_cycle_ = false;
+  this->high_freq_.stop();
+  const uint32_t cycle_time = millis() - this->cycle_start_;
+  ESP_LOGV(TAG, "Polling cycle took %u ms", cycle_time);
+#ifdef USE_SENSOR
+  if (this->cycle_time_sensor_ != nullptr)
+    this->cycle_time_sensor_->publish_state(cycle_time);
+#endif
+}
+
+void Modbus::on_timeout_() {
+  this->timeouts_++;
+#ifdef USE_SENSOR
+  if (this->timeouts_sensor_ != nullptr)
+    this->timeouts_sensor_->publish_state(this->timeouts_);
+#endif
+}
+
+void Modbus::on_crc_error_() {
+  this->crc_errors_++;
+#ifdef USE_SENSOR
+  if (this->crc_errors_sensor_ != nullptr)
+    this->crc_errors_sensor_->publish_state(this->crc_errors_);
+#endif
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
   size_t at = this->rx_buffer_.size();
   this->rx_buffer_.push_back(byte);
+  // The CRC is updated as the bytes arrive, over a frame followed by its own CRC it comes out as zero
+  this->rx_crc_ = crc16(&byte, 1, at == 0 ? 0xFFFF : this->rx_crc_);
   const uint8_t *raw = &this->rx_buffer_[0];
   ESP_LOGV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
   // Byte 0: modbus address (match all)
@@ -68,10 +148,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
     data_len = at - 2;
     data_offset = 1;
 
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-
-    if (computed_crc != remote_crc)
+    if (this->rx_crc_ != 0)
       return true;
 
     ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
@@ -99,17 +176,24 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       return true;
 
     // Byte data_offset+len+1: CRC_HI (over all bytes)
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-    if (computed_crc != remote_crc) {
-      ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
+    if (this->rx_crc_ != 0) {
+      // The CRCs are only computed when the warning is logged
+      ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", crc16(raw, data_offset + data_len),
+               encode_uint16(raw[data_offset + data_len + 1], raw[data_offset + data_len]));
+      this->on_crc_error_();
       return false;
     }
   }
   std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+  // Several devices can share an address, if the scheduler sent the request only the device that sent it gets the
+  // response
+  ModbusDevice *sender = this->current_device_;
+  if (sender != nullptr && sender->get_address() != address)
+    sender = nullptr;
+  this->current_device_ = nullptr;
   bool found = false;
   for (auto *device : this->devices_) {
-    if (device->address_ == address) {
+    if (device->get_address() == address && (sender == nullptr || device == sender)) {
       // Is it an error response?
       if ((function_code & 0x80) == 0x80) {
         ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
@@ -139,7 +223,15 @@ void Modbus::dump_config() {
   ESP_LOGCONFIG(TAG, "Modbus:");
   LOG_PIN("  Flow Control Pin: ", this->flow_control_pin_);
   ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
+  ESP_LOGCONFIG(TAG, "  Frame Delay: %u us", this->frame_delay_us_);
+#ifdef USE_SENSOR
+  LOG_SENSOR("  ", "Timeouts", this->timeouts_sensor_);
+  LOG_SENSOR("  ", "CRC Errors", this->crc_errors_sensor_);
+  LOG_SENSOR("  ", "Cycle Time", this->cycle_time_sensor_);
+#endif
 }
+// Only one request can be on the bus, so devices wait for the response to a request of any device
+bool Modbus::is_waiting_for_response(const ModbusDevice *device) const { return this->waiting_for_response != 0; }
 float Modbus::get_setup_priority() const {
   // After UART bus
   return setup_priority::BUS - 1.0f;
@@ -147,35 +239,9 @@ float Modbus::get_setup_priority() const {
 
 void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
                   uint8_t payload_len, const uint8_t *payload) {
-  static const size_t MAX_VALUES = 128;
-
-  // Only check max number of registers for standard function codes
-  // Some devices use non standard codes like 0x43
-  if (number_of_entities > MAX_VALUES && function_code <= 0x10) {
-    ESP_LOGE(TAG, "send too many values %d max=%zu", number_of_entities, MAX_VALUES);
-    return;
-  }
-
   std::vector<uint8_t> data;
-  data.push_back(address);
-  data.push_back(function_code);
-  data.push_back(start_address >> 8);
-  data.push_back(start_address >> 0);
-  if (function_code != 0x5 && function_code != 0x6) {
-    data.push_back(number_of_entities >> 8);
-    data.push_back(number_of_entities >> 0);
-  }
-
-  if (payload != nullptr) {
-    if (function_code == 0xF || function_code == 0x10) {  // Write multiple
-      data.push_back(payload_len);                        // Byte count is required for write
-    } else {
-      payload_len = 2;  // Write single register or coil
-    }
-    for (int i = 0; i < payload_len; i++) {
-      data.push_back(payload[i]);
-    }
-  }
+  if (!this->build_request_(data, address, function_code, start_address, number_of_entities, payload_len, payload))
+    return;
 
   auto crc = crc16(data.data(), data.size());
   data.push_back(crc >> 0);
@@ -191,6 +257,8 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
     this->flow_control_pin_->digital_write(false);
   waiting_for_response = address;
   last_send_ = millis();
+  this->last_frame_us_ = micros();
+  this->current_device_ = nullptr;
   ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(data).c_str());
 }
 
@@ -214,6 +282,8 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
   waiting_for_response = payload[0];
   ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
   last_send_ = millis();
+  this->last_frame_us_ = micros();
+  this->current_device_ = nullptr;
 }
 
 }  // namespace modbus
@@ -1,14 +1,26 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/modbus_base/modbus_base.h"
 #include "esphome/components/uart/uart.h"
 
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
 namespace esphome {
 namespace modbus {
 
-class ModbusDevice;
-
-class Modbus : public uart::UARTDevice, public Component {
+/** Modbus RTU master on a UART bus.
+ *
+ * The bus schedules the requests of its devices: whenever no response is outstanding and the line has been silent
+ * for 3.5 character times, it asks the devices for their next request, writes of all devices first and the polling
+ * reads round-robin. While requests are pending the loop runs continuously, so the next request goes out as soon as
+ * the previous response is complete instead of on the next loop iteration.
+ */
+class Modbus : public ModbusTransport, public uart::UARTDevice, public Component {
  public:
   Modbus() = default;
 
@@ -18,47 +30,55 @@ class Modbus : public uart::UARTDevice, public Component {
 
   void dump_config() override;
 
-  void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
-
   float get_setup_priority() const override;
 
   void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
-            uint8_t payload_len = 0, const uint8_t *payload = nullptr);
-  void send_raw(const std::vector<uint8_t> &payload);
+            uint8_t payload_len, const uint8_t *payload) override;
+  void send_raw(const std::vector<uint8_t> &payload) override;
+  bool is_waiting_for_response(const ModbusDevice *device) const override;
   void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
   uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
+#ifdef USE_SENSOR
+  void set_timeouts_sensor(sensor::Sensor *sensor) { this->timeouts_sensor_ = sensor; }
+  void set_crc_errors_sensor(sensor::Sensor *sensor) { this->crc_errors_sensor_ = sensor; }
+  void set_cycle_time_sensor(sensor::Sensor *sensor) { this->cycle_time_sensor_ = sensor; }
+#endif
 
  protected:
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  /// Send the next request of the devices if the bus is idle.
+  void send_next_();
+  /// Called when a request went unanswered or a response was corrupted, to update the statistics.
+  void on_timeout_();
+  void on_crc_error_();
   uint16_t send_wait_time_{250};
   std::vector<uint8_t> rx_buffer_;
+  uint16_t rx_crc_{0xFFFF};
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
-  std::vector<ModbusDevice *> devices_;
-};
-
-class ModbusDevice {
- public:
-  void set_parent(Modbus *parent) { parent_ = parent; }
-  void set_address(uint8_t address) { address_ = address; }
-  virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
-  virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
-  void send(uint8_t function, uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len = 0,
-            const uint8_t *payload = nullptr) {
-    this->parent_->send(this->address_, function, start_address, number_of_entities, payload_len, payload);
-  }
-  void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
-  // If more than one device is connected block sending a new command before a response is received
-  bool waiting_for_response() { return parent_->waiting_for_response != 0; }
-
- protected:
-  friend Modbus;
 
-  Modbus *parent_;
-  uint8_t address_;
+  /// Silence between two frames in microseconds, 3.5 character times at the baud rate of the UART.
+  uint32_t frame_delay_us_{1750};
+  /// When the last frame was sent or the last byte was received, in microseconds.
+  uint32_t last_frame_us_{0};
+  /// The device whose request is waiting for its response, nullptr if the request was sent by calling send() directly.
+  ModbusDevice *current_device_{nullptr};
+  /// The device to ask first for its next read, so that all devices get their turn.
+  size_t next_device_{0};
+  /// A polling cycle lasts from the first request after the bus was idle until no device has requests left.
+  bool in_cycle_{false};
+  uint32_t cycle_start_{0};
+  HighFrequencyLoopRequester high_freq_;
+  uint32_t timeouts_{0};
+  uint32_t crc_errors_{0};
+#ifdef USE_SENSOR
+  sensor::Sensor *timeouts_sensor_{nullptr};
+  sensor::Sensor *crc_errors_sensor_{nullptr};
+  sensor::Sensor *cycle_time_sensor_{nullptr};
+#endif
 };
 
 }  // namespace modbus
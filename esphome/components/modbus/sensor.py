@@ -0,0 +1,57 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    DEVICE_CLASS_DURATION,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_MILLISECOND,
+)
+from . import CONF_MODBUS_ID, Modbus
+
+DEPENDENCIES = ["modbus"]
+
+CONF_CRC_ERRORS = "crc_errors"
+CONF_CYCLE_TIME = "cycle_time"
+CONF_TIMEOUTS = "timeouts"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(Modbus),
+        cv.Optional(CONF_TIMEOUTS): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_CRC_ERRORS): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_CYCLE_TIME): sensor.sensor_schema(
+            unit_of_measurement=UNIT_MILLISECOND,
+            accuracy_decimals=0,
+            device_class=DEVICE_CLASS_DURATION,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    bus = await cg.get_variable(config[CONF_MODBUS_ID])
+
+    if CONF_TIMEOUTS in config:
+        sens = await sensor.new_sensor(config[CONF_TIMEOUTS])
+        cg.add(bus.set_timeouts_sensor(sens))
+    if CONF_CRC_ERRORS in config:
+        sens = await sensor.new_sensor(config[CONF_CRC_ERRORS])
+        cg.add(bus.set_crc_errors_sensor(sens))
+    if CONF_CYCLE_TIME in config:
+        sens = await sensor.new_sensor(config[CONF_CYCLE_TIME])
+        cg.add(bus.set_cycle_time_sensor(sens))
@@ -0,0 +1,34 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ADDRESS
+
+# The devices and the transport interface shared by the Modbus RTU bus of the
+# modbus component and the Modbus TCP client of modbus_tcp. This component has no
+# configuration, it is loaded by the components that use it.
+modbus_ns = cg.esphome_ns.namespace("modbus")
+ModbusTransport = modbus_ns.class_("ModbusTransport")
+ModbusDevice = modbus_ns.class_("ModbusDevice")
+
+CONF_MODBUS_ID = "modbus_id"
+
+
+async def to_code(config):
+    cg.add_global(modbus_ns.using)
+
+
+def modbus_device_schema(default_address):
+    schema = {
+        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(ModbusTransport),
+    }
+    if default_address is None:
+        schema[cv.Required(CONF_ADDRESS)] = cv.hex_uint8_t
+    else:
+        schema[cv.Optional(CONF_ADDRESS, default=default_address)] = cv.hex_uint8_t
+    return cv.Schema(schema)
+
+
+async def register_modbus_device(var, config):
+    parent = await cg.get_variable(config[CONF_MODBUS_ID])
+    cg.add(var.set_parent(parent))
+    cg.add(var.set_address(config[CONF_ADDRESS]))
+    cg.add(parent.register_device(var))
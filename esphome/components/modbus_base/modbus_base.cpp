@@ -0,0 +1,44 @@
+#include "modbus_base.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace modbus {
+
+static const char *const TAG = "modbus";
+
+bool ModbusTransport::build_request_(std::vector<uint8_t> &data, uint8_t address, uint8_t function_code,
+                                     uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len,
+                                     const uint8_t *payload) {
+  static const size_t MAX_VALUES = 128;
+
+  // Only check max number of registers for standard function codes
+  // Some devices use non standard codes like 0x43
+  if (number_of_entities > MAX_VALUES && function_code <= 0x10) {
+    ESP_LOGE(TAG, "send too many values %d max=%zu", number_of_entities, MAX_VALUES);
+    return false;
+  }
+
+  data.push_back(address);
+  data.push_back(function_code);
+  data.push_back(start_address >> 8);
+  data.push_back(start_address >> 0);
+  if (function_code != 0x5 && function_code != 0x6) {
+    data.push_back(number_of_entities >> 8);
+    data.push_back(number_of_entities >> 0);
+  }
+
+  if (payload != nullptr) {
+    if (function_code == 0xF || function_code == 0x10) {  // Write multiple
+      data.push_back(payload_len);                        // Byte count is required for write
+    } else {
+      payload_len = 2;  // Write single register or coil
+    }
+    for (int i = 0; i < payload_len; i++) {
+      data.push_back(payload[i]);
+    }
+  }
+  return true;
+}
+
+}  // namespace modbus
+}  // namespace esphome
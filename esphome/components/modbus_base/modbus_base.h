@@ -0,0 +1,74 @@
+#pragma once
+
+#include "esphome/core/helpers.h"
+
+#include <vector>
+
+namespace esphome {
+namespace modbus {
+
+class ModbusDevice;
+
+/** Transport of the requests of ModbusDevices and of the responses to them.
+ *
+ * Modbus implements Modbus RTU on a UART, modbus_tcp::ModbusTCP implements Modbus TCP. The transport asks its devices
+ * for their requests with ModbusDevice::send_next_command() when it can send them, and passes the responses back to the
+ * device that sent the request.
+ */
+class ModbusTransport {
+ public:
+  virtual ~ModbusTransport() = default;
+  void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
+
+  /// Send a request to the device at \p address, see ModbusDevice::send().
+  virtual void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                    uint8_t payload_len, const uint8_t *payload) = 0;
+  /// Send a request built by the caller, \p payload starts with the device address. The transport adds its framing.
+  virtual void send_raw(const std::vector<uint8_t> &payload) = 0;
+  /// Whether a request of \p device is waiting for its response, on a serial bus a request of any device.
+  virtual bool is_waiting_for_response(const ModbusDevice *device) const = 0;
+
+ protected:
+  /** Build the request for send() without the framing of the transport.
+   *
+   * @param data receives the device address, function code and the data of the request.
+   * @return false if the request asks for too many values.
+   */
+  static bool build_request_(std::vector<uint8_t> &data, uint8_t address, uint8_t function_code,
+                             uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len,
+                             const uint8_t *payload);
+
+  std::vector<ModbusDevice *> devices_;
+};
+
+class ModbusDevice {
+ public:
+  virtual ~ModbusDevice() = default;
+  void set_parent(ModbusTransport *parent) { parent_ = parent; }
+  void set_address(uint8_t address) { address_ = address; }
+  virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
+  virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
+  /** Called by the transport when it can send a request, to send the next queued request.
+   *
+   * @param writes_only only send the request if it writes to the device.
+   * @return whether a request was sent.
+   */
+  virtual bool send_next_command(bool writes_only) { return false; }
+  /// Whether requests are queued that send_next_command() has not sent yet.
+  virtual bool has_pending_commands() { return false; }
+  void send(uint8_t function, uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len = 0,
+            const uint8_t *payload = nullptr) {
+    this->parent_->send(this->address_, function, start_address, number_of_entities, payload_len, payload);
+  }
+  void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
+  // If more than one device is connected block sending a new command before a response is received
+  bool waiting_for_response() { return parent_->is_waiting_for_response(this); }
+  uint8_t get_address() const { return this->address_; }
+
+ protected:
+  ModbusTransport *parent_;
+  uint8_t address_;
+};
+
+}  // namespace modbus
+}  // namespace esphome
@@ -1,8 +1,9 @@
 import binascii
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import modbus
+from esphome.components import modbus_base
 from esphome.const import CONF_ADDRESS, CONF_ID, CONF_NAME, CONF_LAMBDA, CONF_OFFSET
+from esphome.core import CORE
 from esphome.cpp_helpers import logging
 from .const import (
     CONF_BITMASK,
@@ -20,14 +21,16 @@ from .const import (
 
 CODEOWNERS = ["@martgras"]
 
-AUTO_LOAD = ["modbus"]
+AUTO_LOAD = ["modbus_base"]
+
+KEY_MODBUS_CONTROLLER = "modbus_controller"
 
 MULTI_CONF = True
 
 # pylint: disable=invalid-name
 modbus_controller_ns = cg.esphome_ns.namespace("modbus_controller")
 ModbusController = modbus_controller_ns.class_(
-    "ModbusController", cg.PollingComponent, modbus.ModbusDevice
+    "ModbusController", cg.PollingComponent, modbus_base.ModbusDevice
 )
 
 SensorItem = modbus_controller_ns.struct("SensorItem")
@@ -108,7 +111,7 @@ CONFIG_SCHEMA = cv.All(
         }
     )
     .extend(cv.polling_component_schema("60s"))
-    .extend(modbus.modbus_device_schema(0x01))
+    .extend(modbus_base.modbus_device_schema(0x01))
 )
 
 
@@ -215,7 +218,16 @@ async def to_code(config):
 async def register_modbus_device(var, config):
     cg.add(var.set_address(config[CONF_ADDRESS]))
     await cg.register_component(var, config)
-    return await modbus.register_modbus_device(var, config)
+
+    # Controllers for the same device on the same bus can merge their reads
+    key = (str(config[modbus_base.CONF_MODBUS_ID]), config[CONF_ADDRESS])
+    siblings = CORE.data.setdefault(KEY_MODBUS_CONTROLLER, {}).setdefault(key, [])
+    for sibling in siblings:
+        cg.add(var.add_sibling(sibling))
+        cg.add(sibling.add_sibling(var))
+    siblings.append(var)
+
+    return await modbus_base.register_modbus_device(var, config)
 
 
 def function_code_to_register(function_code):
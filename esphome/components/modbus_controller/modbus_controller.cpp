@@ -14,35 +14,119 @@ void ModbusController::setup() {
 
 /*
  To work with the existing modbus class and avoid polling for responses a command queue is used.
- send_next_command will submit the command at the top of the queue and set the corresponding callback
- to handle the response from the device.
+ When the bus is idle it calls send_next_command, which submits the command at the top of the queue. Its callback
+ handles the response from the device.
  Once the response has been processed it is removed from the queue and the next command is sent
 */
-bool ModbusController::send_next_command_() {
-  uint32_t last_send = millis() - this->last_command_timestamp_;
+bool ModbusController::send_next_command(bool writes_only) {
+  if (millis() - this->last_command_timestamp_ <= this->command_throttle_)
+    return false;
 
-  if ((last_send > this->command_throttle_) && !waiting_for_response() && !command_queue_.empty()) {
+  // remove from queue if command was sent too often
+  while (!command_queue_.empty() && command_queue_.front()->send_countdown < 1) {
     auto &command = command_queue_.front();
+    ESP_LOGD(TAG,
+             "Modbus command to device=%d register=0x%02X countdown=%d no response received - removed from send queue",
+             this->address_, command->register_address, command->send_countdown);
+    command_queue_.pop_front();
+  }
+  if (command_queue_.empty())
+    return false;
+
+  auto &command = command_queue_.front();
+  if (writes_only && !command->is_write())
+    return false;
+  this->merge_sibling_reads_(*command);
+  ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
+           command->register_address, command->register_count);
+  command->send();
+  this->last_command_timestamp_ = millis();
+  // remove from queue if no handler is defined
+  if (!command->on_data_func) {
+    command_queue_.pop_front();
+  }
+  return true;
+}
 
-    // remove from queue if command was sent too often
-    if (command->send_countdown < 1) {
-      ESP_LOGD(
-          TAG,
-          "Modbus command to device=%d register=0x%02X countdown=%d no response received - removed from send queue",
-          this->address_, command->register_address, command->send_countdown);
-      command_queue_.pop_front();
-    } else {
-      ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
-               command->register_address, command->register_count);
-      command->send();
-      this->last_command_timestamp_ = millis();
-      // remove from queue if no handler is defined
-      if (!command->on_data_func) {
-        command_queue_.pop_front();
+// Pass the registers of one of the merged reads to its handler
+static void dispatch_merged_read(
+    const std::function<void(ModbusRegisterType, uint16_t, const std::vector<uint8_t> &)> &handler,
+    ModbusRegisterType register_type, uint16_t merged_start, uint16_t start_address, uint16_t register_count,
+    const std::vector<uint8_t> &data) {
+  size_t offset = (start_address - merged_start) * 2;
+  if (data.size() < offset + register_count * 2) {
+    ESP_LOGW(TAG, "Merged read response too short for register 0x%X", start_address);
+    return;
+  }
+  if (handler)
+    handler(register_type, start_address,
+            std::vector<uint8_t>(data.begin() + offset, data.begin() + offset + register_count * 2));
+}
+
+void ModbusController::merge_sibling_reads_(ModbusCommandItem &command) {
+  if (!command.mergeable)
+    return;
+  for (auto *sibling : this->siblings_) {
+    auto it = sibling->command_queue_.begin();
+    // On Modbus TCP the siblings poll concurrently, the command at the front may be waiting for its response
+    if (it != sibling->command_queue_.end() && sibling->waiting_for_response())
+      it++;
+    while (it != sibling->command_queue_.end()) {
+      ModbusCommandItem &other = **it;
+      uint16_t start = std::min(command.register_address, other.register_address);
+      uint16_t end = std::max(command.register_address + command.register_count,
+                              other.register_address + other.register_count);
+      // Only merge ranges without a gap between them
+      if (!other.mergeable || other.register_type != command.register_type ||
+          end - start > command.register_count + other.register_count ||
+          end - start > ModbusCommandItem::MAX_READ_REGISTERS) {
+        it++;
+        continue;
+      }
+      ESP_LOGV(TAG, "Merging read of register 0x%X count %d with 0x%X count %d", command.register_address,
+               command.register_count, other.register_address, other.register_count);
+      if (command.merged_reads.empty())
+        command.merged_reads.push_back({this, command.register_address, command.register_count});
+      if (other.merged_reads.empty()) {
+        command.merged_reads.push_back({sibling, other.register_address, other.register_count});
+      } else {
+        command.merged_reads.insert(command.merged_reads.end(), other.merged_reads.begin(), other.merged_reads.end());
       }
+      auto first = std::move(command.on_data_func);
+      auto second = std::move(other.on_data_func);
+      uint16_t first_start = command.register_address, first_count = command.register_count;
+      uint16_t second_start = other.register_address, second_count = other.register_count;
+      command.on_data_func = [first, first_start, first_count, second, second_start, second_count](
+                                 ModbusRegisterType register_type, uint16_t start_address,
+                                 const std::vector<uint8_t> &data) {
+        dispatch_merged_read(first, register_type, start_address, first_start, first_count, data);
+        dispatch_merged_read(second, register_type, start_address, second_start, second_count, data);
+      };
+      command.register_address = start;
+      command.register_count = end - start;
+      it = sibling->command_queue_.erase(it);
+    }
+  }
+}
+
+bool ModbusController::is_merged_read_queued_(const ModbusCommandItem &command) const {
+  auto contains_read = [this, &command](const std::unique_ptr<ModbusCommandItem> &item) {
+    if (item->register_type != command.register_type || item->function_code != command.function_code)
+      return false;
+    for (const auto &read : item->merged_reads) {
+      if (read.owner == this && read.register_address == command.register_address &&
+          read.register_count == command.register_count)
+        return true;
     }
+    return false;
+  };
+  if (std::any_of(this->command_queue_.begin(), this->command_queue_.end(), contains_read))
+    return true;
+  for (auto *sibling : this->siblings_) {
+    if (std::any_of(sibling->command_queue_.begin(), sibling->command_queue_.end(), contains_read))
+      return true;
   }
-  return (!command_queue_.empty());
+  return false;
 }
 
 // Queue incoming response
@@ -75,10 +159,23 @@ void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_
              "payload size=%zu",
              function_code, current_command->register_address, current_command->register_count,
              current_command->payload.size());
+    // The reads of the siblings that were merged into this one failed as well
+    for (const auto &read : current_command->merged_reads) {
+      if (read.owner != this)
+        read.owner->on_merged_read_error_(function_code, exception_code, read);
+    }
     command_queue_.pop_front();
   }
 }
 
+void ModbusController::on_merged_read_error_(uint8_t function_code, uint8_t exception_code,
+                                             const ModbusCommandItem::MergedRead &read) const {
+  ESP_LOGE(TAG,
+           "Modbus error - merged read of device %d: function code=0x%X exception: %d register address = 0x%X "
+           "registers count=%d",
+           this->address_, function_code, exception_code, read.register_address, read.register_count);
+}
+
 SensorSet ModbusController::find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const {
   auto reg_it = find_if(begin(register_ranges_), end(register_ranges_), [=](RegisterRange const &r) {
     return (r.start_address == start_address && r.register_type == register_type);
@@ -117,7 +214,24 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
       return;
     }
   }
-  command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  // A read merged into another one has a different range than the command queued for it
+  if (!command.is_write() && command.function_code != ModbusFunctionCode::CUSTOM &&
+      this->is_merged_read_queued_(command)) {
+    ESP_LOGW(TAG, "Duplicate modbus command found in merged read: type=0x%x address=%u count=%u",
+             static_cast<uint8_t>(command.register_type), command.register_address, command.register_count);
+    return;
+  }
+  auto pos = command_queue_.end();
+  if (command.is_write()) {
+    // Writes go ahead of the queued reads, so they don't wait for a whole polling cycle. A command waiting for its
+    // response has to stay at the front.
+    pos = command_queue_.begin();
+    if (pos != command_queue_.end() && this->waiting_for_response())
+      pos++;
+    while (pos != command_queue_.end() && (*pos)->is_write())
+      pos++;
+  }
+  command_queue_.insert(pos, make_unique<ModbusCommandItem>(command));
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
@@ -140,7 +254,15 @@ void ModbusController::update_range_(RegisterRange &r) {
         queue_command(command_item);
       }
     } else {
-      queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
+      auto command_item =
+          ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count);
+      command_item.mergeable =
+          r.register_type == ModbusRegisterType::HOLDING || r.register_type == ModbusRegisterType::READ;
+      for (auto *sensor : r.sensors) {
+        if (sensor->force_new_range || sensor->response_bytes > 0)
+          command_item.mergeable = false;
+      }
+      queue_command(command_item);
     }
     r.skip_updates_counter = r.skip_updates;  // reset counter to config value
   } else {
@@ -290,16 +412,12 @@ void ModbusController::dump_config() {
 }
 
 void ModbusController::loop() {
-  // Incoming data to process?
+  // Incoming data to process? The modbus sends the pending commands.
   if (!incoming_queue_.empty()) {
     auto &message = incoming_queue_.front();
     if (message != nullptr)
       process_modbus_data_(message.get());
     incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    send_next_command_();
   }
 }
 
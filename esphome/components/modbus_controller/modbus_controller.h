@@ -2,7 +2,7 @@
 
 #include "esphome/core/component.h"
 
-#include "esphome/components/modbus/modbus.h"
+#include "esphome/components/modbus_base/modbus_base.h"
 #include "esphome/core/automation.h"
 
 #include <list>
@@ -297,6 +297,8 @@ class ModbusCommandItem {
  public:
   static const size_t MAX_PAYLOAD_BYTES = 240;
   static const uint8_t MAX_SEND_REPEATS = 5;
+  /// Maximum number of registers a single read may request
+  static const uint16_t MAX_READ_REGISTERS = 125;
   ModbusController *modbusdevice;
   uint16_t register_address;
   uint16_t register_count;
@@ -309,6 +311,24 @@ class ModbusCommandItem {
   // wrong commands (esp. custom commands) can block the send queue
   // limit the number of repeats
   uint8_t send_countdown{MAX_SEND_REPEATS};
+  /// A read of adjacent registers by another controller for the same device can be merged into this read. Only set
+  /// for register reads that are answered with 2 bytes per register and were not split with force_new_range.
+  bool mergeable{false};
+  /// A read that was merged into this command, see ModbusController::merge_sibling_reads_().
+  struct MergedRead {
+    ModbusController *owner;
+    uint16_t register_address;
+    uint16_t register_count;
+  };
+  /// The original reads of a merged command, including its own. Empty if nothing was merged into it.
+  std::vector<MergedRead> merged_reads;
+  /// Whether the command changes registers or coils, the bus sends these before reads
+  bool is_write() const {
+    return this->function_code == ModbusFunctionCode::WRITE_SINGLE_COIL ||
+           this->function_code == ModbusFunctionCode::WRITE_SINGLE_REGISTER ||
+           this->function_code == ModbusFunctionCode::WRITE_MULTIPLE_COILS ||
+           this->function_code == ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS;
+  }
   /// factory methods
   /** Create modbus read command
    *  Function code 02-04
@@ -431,6 +451,11 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
                                   const std::vector<uint8_t> &data);
   /// called by esphome generated code to set the command_throttle period
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
+  /// called by esphome generated code for every other controller with the same address on the same modbus
+  void add_sibling(ModbusController *sibling) { this->siblings_.push_back(sibling); }
+  /// called by the modbus when the bus is idle, sends the next command from the send queue
+  bool send_next_command(bool writes_only) override;
+  bool has_pending_commands() override { return !this->command_queue_.empty(); }
 
  protected:
   /// parse sensormap_ and create range of sequential addresses
@@ -441,8 +466,13 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void update_range_(RegisterRange &r);
   /// parse incoming modbus data
   void process_modbus_data_(const ModbusCommandItem *response);
-  /// send the next modbus command from the send queue
-  bool send_next_command_();
+  /// merge queued reads of the siblings that are adjacent to \p command into it
+  void merge_sibling_reads_(ModbusCommandItem &command);
+  /// whether the read \p command of this controller is queued as part of a merged read
+  bool is_merged_read_queued_(const ModbusCommandItem &command) const;
+  /// report an error response to a merged read of this controller that another controller sent
+  void on_merged_read_error_(uint8_t function_code, uint8_t exception_code,
+                             const ModbusCommandItem::MergedRead &read) const;
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length_() { return command_queue_.size(); }
   /// dump the parsed sensormap for diagnostics
@@ -459,6 +489,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   uint32_t last_command_timestamp_;
   /// min time in ms between sending modbus commands
   uint16_t command_throttle_;
+  /// other controllers for the same device, their reads can be merged with the reads of this controller
+  std::vector<ModbusController *> siblings_;
 };
 
 /** Convert vector<uint8_t> response payload to float.
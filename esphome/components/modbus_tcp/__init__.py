@@ -0,0 +1,42 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import modbus_base
+from esphome.components.network import IPAddress
+from esphome.const import CONF_ID, CONF_PORT
+
+DEPENDENCIES = ["network"]
+AUTO_LOAD = ["modbus_base", "socket"]
+MULTI_CONF = True
+
+modbus_tcp_ns = cg.esphome_ns.namespace("modbus_tcp")
+ModbusTCP = modbus_tcp_ns.class_(
+    "ModbusTCP", modbus_base.ModbusTransport, cg.Component
+)
+
+CONF_HOST = "host"
+CONF_MAX_OUTSTANDING_REQUESTS = "max_outstanding_requests"
+CONF_RESPONSE_TIMEOUT = "response_timeout"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(ModbusTCP),
+        cv.Required(CONF_HOST): cv.ipv4,
+        cv.Optional(CONF_PORT, default=502): cv.port,
+        cv.Optional(CONF_MAX_OUTSTANDING_REQUESTS, default=8): cv.int_range(
+            min=1, max=64
+        ),
+        cv.Optional(
+            CONF_RESPONSE_TIMEOUT, default="1s"
+        ): cv.positive_time_period_milliseconds,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    cg.add(var.set_host(IPAddress(*config[CONF_HOST].args)))
+    cg.add(var.set_port(config[CONF_PORT]))
+    cg.add(var.set_max_outstanding_requests(config[CONF_MAX_OUTSTANDING_REQUESTS]))
+    cg.add(var.set_response_timeout(config[CONF_RESPONSE_TIMEOUT]))
@@ -0,0 +1,286 @@
+#include "modbus_tcp.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/components/network/util.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace esphome {
+namespace modbus_tcp {
+
+static const char *const TAG = "modbus_tcp";
+
+// The MBAP header: transaction id, protocol id (0 for Modbus) and the length of the rest of the frame
+static const size_t MBAP_HEADER_SIZE = 6;
+// Unit id and function code up to the maximum PDU size of 253 bytes
+static const uint16_t MIN_FRAME_LENGTH = 2;
+static const uint16_t MAX_FRAME_LENGTH = 254;
+static const uint32_t RECONNECT_INTERVAL = 1000;
+static const uint32_t CONNECT_TIMEOUT = 10000;
+
+void ModbusTCP::setup() { this->rx_buffer_.reserve(MBAP_HEADER_SIZE + MAX_FRAME_LENGTH); }
+
+void ModbusTCP::loop() {
+  if (!network::is_connected()) {
+    if (this->socket_ != nullptr)
+      this->disconnect_();
+    return;
+  }
+  const uint32_t now = millis();
+  if (this->socket_ == nullptr) {
+    if (now - this->last_connect_attempt_ >= RECONNECT_INTERVAL)
+      this->connect_();
+    if (this->socket_ == nullptr)
+      return;
+  }
+
+  if (!this->connected_) {
+    struct sockaddr_in server;
+    memset(&server, 0, sizeof(server));
+    server.sin_family = AF_INET;
+    server.sin_port = htons(this->port_);
+    server.sin_addr.s_addr = uint32_t(this->host_);
+    if (this->socket_->connect(reinterpret_cast<struct sockaddr *>(&server), sizeof(server)) != 0) {
+      if (errno != EINPROGRESS || now - this->last_connect_attempt_ > CONNECT_TIMEOUT) {
+        ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.str().c_str(), this->port_, errno);
+        this->disconnect_();
+      }
+      return;
+    }
+    ESP_LOGD(TAG, "Connected to %s:%u", this->host_.str().c_str(), this->port_);
+    this->connected_ = true;
+  }
+
+  this->read_();
+  if (this->socket_ == nullptr)
+    return;
+
+  // A response that arrives after its timeout is dropped, its transaction id isn't pending anymore
+  for (auto it = this->pending_.begin(); it != this->pending_.end();) {
+    if (now - it->sent_at > this->response_timeout_) {
+      ESP_LOGV(TAG, "No response from unit 0x%02X to transaction %u", it->unit, it->id);
+      it = this->pending_.erase(it);
+    } else {
+      it++;
+    }
+  }
+
+  this->send_next_();
+  this->flush_();
+}
+
+void ModbusTCP::connect_() {
+  this->last_connect_attempt_ = millis();
+  this->socket_ = socket::socket(AF_INET, SOCK_STREAM, 0);
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return;
+  }
+  this->socket_->setblocking(false);
+  int enable = 1;
+  this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+  this->connected_ = false;
+}
+
+void ModbusTCP::disconnect_() {
+  if (this->connected_)
+    ESP_LOGW(TAG, "Disconnected from %s:%u", this->host_.str().c_str(), this->port_);
+  this->socket_->close();
+  this->socket_ = nullptr;
+  this->connected_ = false;
+  this->rx_buffer_.clear();
+  this->tx_buffer_.clear();
+  // The devices send their requests again once the connection is back
+  this->pending_.clear();
+  this->high_freq_.stop();
+}
+
+void ModbusTCP::send_next_() {
+  if (this->devices_.empty())
+    return;
+  // Writes go first, so that switching something doesn't wait for the polling of all devices
+  for (auto *device : this->devices_) {
+    if (!this->can_send_())
+      break;
+    if (this->is_waiting_for_response(device))
+      continue;
+    this->sending_device_ = device;
+    device->send_next_command(true);
+  }
+  size_t count = this->devices_.size();
+  size_t first = this->next_device_;
+  for (size_t i = 0; i < count && this->can_send_(); i++) {
+    auto *device = this->devices_[(first + i) % count];
+    if (this->is_waiting_for_response(device))
+      continue;
+    this->sending_device_ = device;
+    if (device->send_next_command(false))
+      this->next_device_ = (first + i + 1) % count;
+  }
+  this->sending_device_ = nullptr;
+
+  if (!this->pending_.empty()) {
+    this->high_freq_.start();
+    return;
+  }
+  for (auto *device : this->devices_) {
+    // Requests held back by a command throttle are sent on one of the next loop iterations
+    if (device->has_pending_commands())
+      return;
+  }
+  this->high_freq_.stop();
+}
+
+void ModbusTCP::send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+                     uint8_t payload_len, const uint8_t *payload) {
+  std::vector<uint8_t> data;
+  if (!this->build_request_(data, address, function_code, start_address, number_of_entities, payload_len, payload))
+    return;
+  this->send_frame_(data.data(), data.size());
+}
+
+// Helper function for lambdas
+// Send raw command. Except the MBAP header everything must be contained in payload, starting with the unit id
+void ModbusTCP::send_raw(const std::vector<uint8_t> &payload) {
+  if (payload.empty())
+    return;
+  this->send_frame_(payload.data(), payload.size());
+}
+
+void ModbusTCP::send_frame_(const uint8_t *pdu, size_t len) {
+  if (!this->connected_) {
+    ESP_LOGW(TAG, "Not connected, dropping request to unit 0x%02X", pdu[0]);
+    return;
+  }
+  if (len < MIN_FRAME_LENGTH || len > MAX_FRAME_LENGTH) {
+    ESP_LOGW(TAG, "Invalid request length %zu", len);
+    return;
+  }
+  uint16_t id = this->next_transaction_id_++;
+  const uint8_t header[MBAP_HEADER_SIZE] = {
+      uint8_t(id >> 8), uint8_t(id >> 0), 0, 0, uint8_t(len >> 8), uint8_t(len >> 0),
+  };
+  this->tx_buffer_.insert(this->tx_buffer_.end(), header, header + MBAP_HEADER_SIZE);
+  this->tx_buffer_.insert(this->tx_buffer_.end(), pdu, pdu + len);
+  this->pending_.push_back(Transaction{id, pdu[0], this->sending_device_, millis()});
+  ESP_LOGV(TAG, "Modbus write transaction %u: %s", id, format_hex_pretty(pdu, len).c_str());
+}
+
+void ModbusTCP::flush_() {
+  if (this->tx_buffer_.empty())
+    return;
+  ssize_t written = this->socket_->write(this->tx_buffer_.data(), this->tx_buffer_.size());
+  if (written < 0) {
+    if (errno != EWOULDBLOCK && errno != EAGAIN) {
+      ESP_LOGW(TAG, "Socket write failed: errno %d", errno);
+      this->disconnect_();
+    }
+    return;
+  }
+  this->tx_buffer_.erase(this->tx_buffer_.begin(), this->tx_buffer_.begin() + written);
+}
+
+void ModbusTCP::read_() {
+  uint8_t buf[128];
+  while (true) {
+    ssize_t received = this->socket_->read(buf, sizeof(buf));
+    if (received < 0 && (errno == EWOULDBLOCK || errno == EAGAIN))
+      break;
+    if (received <= 0) {
+      if (received < 0)
+        ESP_LOGW(TAG, "Socket read failed: errno %d", errno);
+      this->disconnect_();
+      return;
+    }
+    this->rx_buffer_.insert(this->rx_buffer_.end(), buf, buf + received);
+  }
+
+  size_t at = 0;
+  while (this->rx_buffer_.size() - at >= MBAP_HEADER_SIZE) {
+    const uint8_t *frame = &this->rx_buffer_[at];
+    uint16_t length = encode_uint16(frame[4], frame[5]);
+    if (frame[2] != 0 || frame[3] != 0 || length < MIN_FRAME_LENGTH || length > MAX_FRAME_LENGTH) {
+      // The frames can't be told apart anymore
+      ESP_LOGW(TAG, "Invalid MBAP header: %s", format_hex_pretty(frame, MBAP_HEADER_SIZE).c_str());
+      this->disconnect_();
+      return;
+    }
+    if (this->rx_buffer_.size() - at < MBAP_HEADER_SIZE + length)
+      break;
+    this->handle_frame_(frame, MBAP_HEADER_SIZE + length);
+    at += MBAP_HEADER_SIZE + length;
+  }
+  this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + at);
+}
+
+void ModbusTCP::handle_frame_(const uint8_t *frame, size_t len) {
+  uint16_t id = encode_uint16(frame[0], frame[1]);
+  uint8_t unit = frame[6];
+  uint8_t function_code = frame[7];
+  ESP_LOGV(TAG, "Modbus received transaction %u: %s", id, format_hex_pretty(frame + 6, len - 6).c_str());
+
+  auto it = std::find_if(this->pending_.begin(), this->pending_.end(),
+                         [id](const Transaction &transaction) { return transaction.id == id; });
+  if (it == this->pending_.end()) {
+    ESP_LOGD(TAG, "Ignoring response to unknown transaction %u", id);
+    return;
+  }
+  modbus::ModbusDevice *sender = it->device;
+  this->pending_.erase(it);
+
+  // Pass the same data as the RTU transport, the PDU without the function code and byte count
+  const uint8_t *pdu = frame + 7;
+  size_t pdu_len = len - 7;
+  size_t data_offset = 2, data_len = 0;
+  bool error = (function_code & 0x80) == 0x80;
+  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
+    // User-defined function codes get the whole PDU
+    data_offset = 0;
+    data_len = pdu_len;
+  } else if (error) {
+    data_offset = 1;
+    data_len = 1;
+  } else if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
+    // The response for write command mirrors the requests
+    data_offset = 1;
+    data_len = 4;
+  } else if (pdu_len >= 2) {
+    data_len = pdu[1];
+  }
+  if (pdu_len < data_offset + data_len) {
+    ESP_LOGW(TAG, "Response to transaction %u too short", id);
+    return;
+  }
+  std::vector<uint8_t> data(pdu + data_offset, pdu + data_offset + data_len);
+
+  for (auto *device : this->devices_) {
+    if (device->get_address() != unit || (sender != nullptr && device != sender))
+      continue;
+    if (error) {
+      ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, pdu[1]);
+      device->on_modbus_error(function_code & 0x7F, pdu[1]);
+    } else {
+      device->on_modbus_data(data);
+    }
+  }
+}
+
+bool ModbusTCP::is_waiting_for_response(const modbus::ModbusDevice *device) const {
+  for (const auto &transaction : this->pending_) {
+    if (transaction.device == device || (transaction.device == nullptr && transaction.unit == device->get_address()))
+      return true;
+  }
+  return false;
+}
+
+void ModbusTCP::dump_config() {
+  ESP_LOGCONFIG(TAG, "Modbus TCP:");
+  ESP_LOGCONFIG(TAG, "  Server: %s:%u", this->host_.str().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Max Outstanding Requests: %u", this->max_outstanding_requests_);
+  ESP_LOGCONFIG(TAG, "  Response Timeout: %u ms", this->response_timeout_);
+}
+
+}  // namespace modbus_tcp
+}  // namespace esphome
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/components/modbus_base/modbus_base.h"
+#include "esphome/components/network/ip_address.h"
+#include "esphome/components/socket/socket.h"
+
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace modbus_tcp {
+
+/** Modbus TCP client, the transport of the ModbusDevices of a Modbus TCP server or gateway.
+ *
+ * Requests are framed with the MBAP header and several of them can wait for their responses at the same time, the
+ * transaction id of a response selects the device it belongs to. Each device still has one request in flight, but
+ * unlike on a serial bus the devices don't wait for each other, up to max_outstanding_requests.
+ */
+class ModbusTCP : public modbus::ModbusTransport, public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_WIFI; }
+
+  void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
+            uint8_t payload_len, const uint8_t *payload) override;
+  void send_raw(const std::vector<uint8_t> &payload) override;
+  bool is_waiting_for_response(const modbus::ModbusDevice *device) const override;
+
+  void set_host(network::IPAddress host) { this->host_ = host; }
+  void set_port(uint16_t port) { this->port_ = port; }
+  void set_max_outstanding_requests(uint8_t max_outstanding_requests) {
+    this->max_outstanding_requests_ = max_outstanding_requests;
+  }
+  void set_response_timeout(uint32_t response_timeout) { this->response_timeout_ = response_timeout; }
+
+ protected:
+  /// A request waiting for its response.
+  struct Transaction {
+    uint16_t id;
+    uint8_t unit;
+    /// The device that sent the request, nullptr if it was sent by calling send() directly.
+    modbus::ModbusDevice *device;
+    uint32_t sent_at;
+  };
+
+  void connect_();
+  void disconnect_();
+  /// Queue the request in \p pdu, which starts with the unit id, behind an MBAP header.
+  void send_frame_(const uint8_t *pdu, size_t len);
+  void flush_();
+  void read_();
+  void handle_frame_(const uint8_t *frame, size_t len);
+  /// Send the next requests of the devices that are not waiting for a response.
+  void send_next_();
+  bool can_send_() const { return this->pending_.size() < this->max_outstanding_requests_; }
+
+  network::IPAddress host_;
+  uint16_t port_{502};
+  uint8_t max_outstanding_requests_{8};
+  uint32_t response_timeout_{1000};
+
+  std::unique_ptr<socket::Socket> socket_;
+  bool connected_{false};
+  uint32_t last_connect_attempt_{0};
+  std::vector<uint8_t> rx_buffer_;
+  std::vector<uint8_t> tx_buffer_;
+
+  std::vector<Transaction> pending_;
+  uint16_t next_transaction_id_{0};
+  /// The device asked by send_next_() for its request, send() attributes the request to it.
+  modbus::ModbusDevice *sending_device_{nullptr};
+  /// The device to ask first for its next read, so that all devices get their turn.
+  size_t next_device_{0};
+  HighFrequencyLoopRequester high_freq_;
+};
+
+}  // namespace modbus_tcp
+}  // namespace esphome
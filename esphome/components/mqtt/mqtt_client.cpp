@@ -6,6 +6,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/components/network/util.h"
+#include <algorithm>
 #include <utility>
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -19,6 +20,11 @@ namespace mqtt {
 
 static const char *const TAG = "mqtt";
 
+/// Time per loop that is spent sending scheduled discovery info and states.
+static const uint32_t RESEND_TIME_BUDGET = 20;
+/// Time to wait after a failed publish before sending scheduled discovery info and states again.
+static const uint32_t RESEND_BACKOFF = 250;
+
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
   this->credentials_.client_id = App.get_name() + "-" + get_mac_address();
@@ -291,6 +297,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->send_scheduled_states_();
       }
       break;
   }
@@ -337,6 +344,36 @@ void MQTTClientComponent::resubscribe_subscriptions_() {
   }
 }
 
+void MQTTClientComponent::send_scheduled_states_() {
+  const uint32_t start = millis();
+  if (this->resend_failed_) {
+    if (start - this->resend_failed_at_ < RESEND_BACKOFF)
+      return;
+    this->resend_failed_ = false;
+  }
+
+  // Sending the discovery info of all components at once after connecting overflows the outgoing
+  // buffer on nodes with many entities, so only send as many as fit in the time budget of this loop.
+  for (size_t i = 0; i < this->children_.size(); i++) {
+    if (this->resend_at_ >= this->children_.size())
+      this->resend_at_ = 0;
+    MQTTComponent *component = this->children_[this->resend_at_];
+    if (component->is_resend_state_scheduled()) {
+      if (!component->send_scheduled_state()) {
+        // Retry the same component once the outgoing buffer had time to drain
+        this->resend_failed_ = true;
+        this->resend_failed_at_ = millis();
+        return;
+      }
+      if (millis() - start > RESEND_TIME_BUDGET) {
+        this->resend_at_++;
+        return;
+      }
+    }
+    this->resend_at_++;
+  }
+}
+
 void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t callback, uint8_t qos) {
   MQTTSubscription subscription{
       .topic = topic,
@@ -344,9 +381,9 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
       .callback = std::move(callback),
       .subscribed = false,
       .resubscribe_timeout = 0,
+      .removed = false,
   };
-  this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  this->add_subscription_(std::move(subscription));
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
@@ -359,9 +396,21 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
       .callback = f,
       .subscribed = false,
       .resubscribe_timeout = 0,
+      .removed = false,
   };
+  this->add_subscription_(std::move(subscription));
+}
+
+void MQTTClientComponent::add_subscription_(MQTTSubscription &&subscription) {
   this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  if (this->dispatching_) {
+    // Adding it could move the callback that is running
+    this->added_subscriptions_.push_back(std::move(subscription));
+    this->subscriptions_changed_ = true;
+    return;
+  }
+  this->subscriptions_.push_back(std::move(subscription));
+  this->subscription_trie_.insert(this->subscriptions_.back().topic, this->subscriptions_.size() - 1);
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -375,14 +424,41 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
     this->status_momentary_warning("unsubscribe", 1000);
   }
 
-  auto it = subscriptions_.begin();
-  while (it != subscriptions_.end()) {
-    if (it->topic == topic) {
-      it = subscriptions_.erase(it);
-    } else {
-      ++it;
+  auto matches_topic = [&topic](const MQTTSubscription &sub) { return sub.topic == topic; };
+  this->added_subscriptions_.erase(
+      std::remove_if(this->added_subscriptions_.begin(), this->added_subscriptions_.end(), matches_topic),
+      this->added_subscriptions_.end());
+  if (this->dispatching_) {
+    // Erasing them would shift the subscriptions on_message() is calling, it removes them when it is done
+    for (auto &subscription : this->subscriptions_) {
+      if (matches_topic(subscription)) {
+        subscription.removed = true;
+        this->subscriptions_changed_ = true;
+      }
     }
+    return;
   }
+  this->subscriptions_.erase(std::remove_if(this->subscriptions_.begin(), this->subscriptions_.end(), matches_topic),
+                             this->subscriptions_.end());
+  this->rebuild_subscription_trie_();
+}
+
+void MQTTClientComponent::update_subscriptions_() {
+  this->subscriptions_.erase(std::remove_if(this->subscriptions_.begin(), this->subscriptions_.end(),
+                                            [](const MQTTSubscription &sub) { return sub.removed; }),
+                             this->subscriptions_.end());
+  for (auto &subscription : this->added_subscriptions_)
+    this->subscriptions_.push_back(std::move(subscription));
+  this->added_subscriptions_.clear();
+  this->rebuild_subscription_trie_();
+  this->subscriptions_changed_ = false;
+}
+
+void MQTTClientComponent::rebuild_subscription_trie_() {
+  // The indices of the subscriptions changed
+  this->subscription_trie_.clear();
+  for (size_t i = 0; i < this->subscriptions_.size(); i++)
+    this->subscription_trie_.insert(this->subscriptions_[i].topic, i);
 }
 
 // Publish
@@ -427,73 +503,25 @@ bool MQTTClientComponent::publish_json(const std::string &topic, const json::jso
   return this->publish(topic, message, qos, retain);
 }
 
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
-}
-
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
 #ifdef USE_ESP8266
   // on ESP8266, this is called in LWiP thread; some components do not like running
   // in an ISR.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    this->matches_.clear();
+    this->subscription_trie_.match(topic, this->matches_);
+    // Call the callbacks in the order of subscription
+    std::sort(this->matches_.begin(), this->matches_.end());
+    this->dispatching_ = true;
+    for (size_t index : this->matches_) {
+      // A callback might have unsubscribed
+      if (!this->subscriptions_[index].removed)
+        this->subscriptions_[index].callback(topic, payload);
     }
+    this->dispatching_ = false;
+    if (this->subscriptions_changed_)
+      this->update_subscriptions_();
 #ifdef USE_ESP8266
   });
 #endif
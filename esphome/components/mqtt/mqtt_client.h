@@ -14,6 +14,7 @@
 #elif defined(USE_ARDUINO)
 #include "mqtt_backend_arduino.h"
 #endif
+#include "mqtt_topic_trie.h"
 #include "lwip/ip_addr.h"
 
 namespace esphome {
@@ -38,6 +39,8 @@ struct MQTTSubscription {
   mqtt_callback_t callback;
   bool subscribed;
   uint32_t resubscribe_timeout;
+  /// Unsubscribed while on_message() called the callbacks, removed once it is done.
+  bool removed;
 };
 
 /// internal struct for MQTT credentials.
@@ -265,6 +268,12 @@ class MQTTClientComponent : public Component {
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
+  void add_subscription_(MQTTSubscription &&subscription);
+  /// Apply the changes to the subscriptions made by the callbacks called by on_message().
+  void update_subscriptions_();
+  void rebuild_subscription_trie_();
+  /// Send the discovery info and state of the components that scheduled a resend, a few per loop.
+  void send_scheduled_states_();
 
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
@@ -292,6 +301,15 @@ class MQTTClientComponent : public Component {
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Maps topics to the indices of the matching subscriptions.
+  TopicTrie subscription_trie_;
+  /// The subscriptions matching the message in on_message(), kept to not allocate for every message.
+  std::vector<size_t> matches_;
+  /// Whether on_message() is calling callbacks, subscriptions_ must not be resized then.
+  bool dispatching_{false};
+  bool subscriptions_changed_{false};
+  /// Subscribed while on_message() called the callbacks, added once it is done.
+  std::vector<MQTTSubscription> added_subscriptions_;
 #if defined(USE_ESP_IDF)
   MQTTBackendIDF mqtt_backend_;
 #elif defined(USE_ARDUINO)
@@ -303,6 +321,11 @@ class MQTTClientComponent : public Component {
   bool dns_resolved_{false};
   bool dns_resolve_error_{false};
   std::vector<MQTTComponent *> children_;
+  /// The child send_scheduled_states_() continues with in the next loop.
+  size_t resend_at_{0};
+  /// When sending a scheduled state last failed, to back off while the outgoing buffer drains.
+  uint32_t resend_failed_at_{0};
+  bool resend_failed_{false};
   uint32_t reboot_timeout_{300000};
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
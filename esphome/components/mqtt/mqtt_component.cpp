@@ -27,15 +27,15 @@ std::string MQTTComponent::get_default_topic_for_(const std::string &suffix) con
          "/" + suffix;
 }
 
-std::string MQTTComponent::get_state_topic_() const {
+const std::string &MQTTComponent::get_state_topic_() const {
   if (this->custom_state_topic_.empty())
-    return this->get_default_topic_for_("state");
+    this->custom_state_topic_ = this->get_default_topic_for_("state");
   return this->custom_state_topic_;
 }
 
-std::string MQTTComponent::get_command_topic_() const {
+const std::string &MQTTComponent::get_command_topic_() const {
   if (this->custom_command_topic_.empty())
-    return this->get_default_topic_for_("command");
+    this->custom_command_topic_ = this->get_default_topic_for_("command");
   return this->custom_command_topic_;
 }
 
@@ -188,17 +188,8 @@ void MQTTComponent::call_setup() {
 
   global_mqtt_client->register_mqtt_component(this);
 
-  if (!this->is_connected_())
-    return;
-
-  if (this->is_discovery_enabled()) {
-    if (!this->send_discovery_()) {
-      this->schedule_resend_state();
-    }
-  }
-  if (!this->send_initial_state()) {
-    this->schedule_resend_state();
-  }
+  // The discovery info and initial state are sent by the client, paced with the other components
+  this->schedule_resend_state();
 }
 
 void MQTTComponent::call_loop() {
@@ -206,20 +197,21 @@ void MQTTComponent::call_loop() {
     return;
 
   this->loop();
+}
 
-  if (!this->resend_state_ || !this->is_connected_()) {
-    return;
-  }
-
+bool MQTTComponent::send_scheduled_state() {
   this->resend_state_ = false;
   if (this->is_discovery_enabled()) {
     if (!this->send_discovery_()) {
       this->schedule_resend_state();
+      return false;
     }
   }
   if (!this->send_initial_state()) {
     this->schedule_resend_state();
+    return false;
   }
+  return true;
 }
 void MQTTComponent::call_dump_config() {
   if (this->is_internal())
@@ -29,13 +29,14 @@ struct SendDiscoveryConfig {
 
 #define MQTT_COMPONENT_CUSTOM_TOPIC_(name, type) \
  protected: \
-  std::string custom_##name##_##type##_topic_{}; \
+  /* The custom topic, or the default topic once it was first requested */ \
+  mutable std::string custom_##name##_##type##_topic_{}; \
 \
  public: \
   void set_custom_##name##_##type##_topic(const std::string &topic) { this->custom_##name##_##type##_topic_ = topic; } \
-  std::string get_##name##_##type##_topic() const { \
+  const std::string &get_##name##_##type##_topic() const { \
     if (this->custom_##name##_##type##_topic_.empty()) \
-      return this->get_default_topic_for_(#name "/" #type); \
+      this->custom_##name##_##type##_topic_ = this->get_default_topic_for_(#name "/" #type); \
     return this->custom_##name##_##type##_topic_; \
   }
 
@@ -106,6 +107,13 @@ class MQTTComponent : public Component {
 
   /// Internal method for the MQTT client base to schedule a resend of the state on reconnect.
   void schedule_resend_state();
+  /// Internal method for the MQTT client base, whether a resend of the state is scheduled.
+  bool is_resend_state_scheduled() const { return this->resend_state_; }
+  /** Internal method for the MQTT client base to send the discovery info and state after a resend was scheduled.
+   *
+   * @return Whether the messages were sent, otherwise the resend stays scheduled.
+   */
+  bool send_scheduled_state();
 
   /** Send a MQTT message.
    *
@@ -173,10 +181,10 @@ class MQTTComponent : public Component {
   virtual bool is_disabled_by_default() const;
 
   /// Get the MQTT topic that new states will be shared to.
-  std::string get_state_topic_() const;
+  const std::string &get_state_topic_() const;
 
   /// Get the MQTT topic for listening to commands.
-  std::string get_command_topic_() const;
+  const std::string &get_command_topic_() const;
 
   bool is_connected_() const;
 
@@ -188,8 +196,9 @@ class MQTTComponent : public Component {
   /// Generate the Home Assistant MQTT discovery object id by automatically transforming the friendly name.
   std::string get_default_object_id_() const;
 
-  std::string custom_state_topic_{};
-  std::string custom_command_topic_{};
+  // The custom topics, or the default topics once they were first requested, so they aren't built for every message
+  mutable std::string custom_state_topic_{};
+  mutable std::string custom_command_topic_{};
   bool command_retain_{false};
   bool retain_{true};
   bool discovery_enabled_{true};
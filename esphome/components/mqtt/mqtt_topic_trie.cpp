@@ -0,0 +1,96 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+#include <algorithm>
+
+namespace esphome {
+namespace mqtt {
+
+void TopicTrie::insert(const std::string &filter, size_t id) {
+  Node *node = &this->root_;
+  const char *level = filter.c_str();
+  const char *end = level + filter.size();
+  while (true) {
+    const char *level_end = std::find(level, end, '/');
+    size_t len = level_end - level;
+    if (len == 1 && *level == '#') {
+      // MQTT mandates that # is the last level of the filter
+      node->multi_level_ids.push_back(id);
+      return;
+    }
+    if (len == 1 && *level == '+') {
+      if (node->single_level == nullptr)
+        node->single_level.reset(new Node());
+      node = node->single_level.get();
+    } else {
+      node = get_or_add_child_(node, level, len);
+    }
+    if (level_end == end)
+      break;
+    level = level_end + 1;
+  }
+  node->ids.push_back(id);
+}
+
+void TopicTrie::clear() { this->root_ = Node(); }
+
+void TopicTrie::match(const std::string &topic, std::vector<size_t> &ids) const {
+  // Wildcards at the first level don't match topics starting with $, like $SYS/...
+  bool wildcards = topic.empty() || topic[0] != '$';
+  match_(&this->root_, topic.c_str(), topic.c_str() + topic.size(), wildcards, ids);
+}
+
+void TopicTrie::match_(const Node *node, const char *level, const char *end, bool wildcards,
+                       std::vector<size_t> &ids) {
+  // # also matches the parent level, "a/#" matches "a"
+  if (wildcards)
+    ids.insert(ids.end(), node->multi_level_ids.begin(), node->multi_level_ids.end());
+  if (level == nullptr) {
+    ids.insert(ids.end(), node->ids.begin(), node->ids.end());
+    return;
+  }
+
+  const char *level_end = std::find(level, end, '/');
+  const char *next = level_end == end ? nullptr : level_end + 1;
+  if (wildcards && node->single_level != nullptr)
+    match_(node->single_level.get(), next, end, true, ids);
+  const Node *child = find_child_(node, level, level_end - level);
+  if (child != nullptr)
+    match_(child, next, end, true, ids);
+}
+
+TopicTrie::Node *TopicTrie::get_or_add_child_(Node *node, const char *level, size_t len) {
+  size_t i = lower_bound_(node, level, len);
+  if (i < node->children.size() && node->children[i]->level.compare(0, std::string::npos, level, len) == 0)
+    return node->children[i].get();
+  std::unique_ptr<Node> child(new Node());
+  child->level.assign(level, len);
+  return node->children.insert(node->children.begin() + i, std::move(child))->get();
+}
+
+const TopicTrie::Node *TopicTrie::find_child_(const Node *node, const char *level, size_t len) {
+  size_t i = lower_bound_(node, level, len);
+  if (i < node->children.size() && node->children[i]->level.compare(0, std::string::npos, level, len) == 0)
+    return node->children[i].get();
+  return nullptr;
+}
+
+size_t TopicTrie::lower_bound_(const Node *node, const char *level, size_t len) {
+  size_t lo = 0;
+  size_t hi = node->children.size();
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (node->children[mid]->level.compare(0, std::string::npos, level, len) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Routes the topics of incoming messages to the subscriptions with a matching topic filter.
+ *
+ * The filters are split into their levels once when subscribing, so matching a topic only walks its
+ * levels instead of comparing it with every subscription. The + and # wildcards are supported, they
+ * don't match topics starting with $ at the first level.
+ */
+class TopicTrie {
+ public:
+  /** Add a topic filter.
+   *
+   * @param filter The topic filter, may contain the + and # wildcards.
+   * @param id The id that match() returns for topics matching this filter.
+   */
+  void insert(const std::string &filter, size_t id);
+
+  /// Remove all topic filters.
+  void clear();
+
+  /** Find the topic filters matching a topic.
+   *
+   * @param topic The topic of a message, without wildcards.
+   * @param ids The ids of the matching filters are appended to this, unordered.
+   */
+  void match(const std::string &topic, std::vector<size_t> &ids) const;
+
+ protected:
+  struct Node {
+    std::string level;
+    /// The children for literal levels, sorted by level.
+    std::vector<std::unique_ptr<Node>> children;
+    /// The child for the + wildcard.
+    std::unique_ptr<Node> single_level;
+    /// The filters that end at this node.
+    std::vector<size_t> ids;
+    /// The filters that end with a # wildcard after this node.
+    std::vector<size_t> multi_level_ids;
+  };
+
+  static Node *get_or_add_child_(Node *node, const char *level, size_t len);
+  static const Node *find_child_(const Node *node, const char *level, size_t len);
+  /// Binary search for the index of the first child that isn't less than level.
+  static size_t lower_bound_(const Node *node, const char *level, size_t len);
+  /// Match the rest of a topic, from level to end, or nullptr when all levels were consumed.
+  static void match_(const Node *node, const char *level, const char *end, bool wildcards, std::vector<size_t> &ids);
+
+  Node root_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -18,7 +18,7 @@ from esphome.const import (
     CONF_CYCLE,
 )
 from esphome.core import CORE, coroutine_with_priority
-from esphome.cpp_helpers import setup_entity
+from esphome.cpp_helpers import register_entity_key, setup_entity
 
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
@@ -125,6 +125,7 @@ async def register_number(
     if not CORE.has_id(config[CONF_ID]):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_number(var))
+    register_entity_key("number", config)
     await setup_number_core_(
         var, config, min_value=min_value, max_value=max_value, step=step
     )
@@ -44,7 +44,7 @@ std::unique_ptr<OTABackend> make_ota_backend() {
 OTAComponent::OTAComponent() { global_ota_component = this; }
 
 void OTAComponent::setup() {
-  server_ = socket::socket_ip(SOCK_STREAM, 0);
+  server_ = socket::socket_ip_monitored(SOCK_STREAM, 0);
   if (server_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -129,7 +129,7 @@ void OTAComponent::handle_() {
   std::unique_ptr<OTABackend> backend;
   (void) ota_features;
 
-  if (client_ == nullptr) {
+  if (client_ == nullptr && server_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     client_ = server_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -285,7 +285,17 @@ void OTAComponent::handle_() {
   while (total < ota_size) {
     // TODO: timeout check
     size_t requested = std::min(sizeof(buf), ota_size - total);
-    ssize_t read = this->client_->read(buf, requested);
+    // write straight from the receive buffer of the socket if it exposes it, instead of copying into buf
+    uint8_t *data;
+    ssize_t read = this->client_->peek(&data);
+    bool peeked = read != -1 || errno != EOPNOTSUPP;
+    if (peeked) {
+      if (read > 0)
+        read = std::min((size_t) read, requested);
+    } else {
+      data = buf;
+      read = this->client_->read(buf, requested);
+    }
     if (read == -1) {
       if (errno == EAGAIN || errno == EWOULDBLOCK) {
         App.feed_wdt();
@@ -302,7 +312,9 @@ void OTAComponent::handle_() {
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
     }
 
-    error_code = backend->write(buf, read);
+    error_code = backend->write(data, read);
+    if (peeked)
+      this->client_->consume(read);
     if (error_code != OTA_RESPONSE_OK) {
       ESP_LOGW(TAG, "Error writing binary data to flash!, error_code: %d", error_code);
       goto error;  // NOLINT(cppcoreguidelines-avoid-goto)
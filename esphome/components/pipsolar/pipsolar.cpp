@@ -1,5 +1,6 @@
 #include "pipsolar.h"
 #include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace pipsolar {
@@ -893,31 +894,11 @@ void Pipsolar::add_polling_command_(const char *command, ENUMPollingCommand poll
 }
 
 uint16_t Pipsolar::cal_crc_half_(uint8_t *msg, uint8_t len) {
-  uint16_t crc;
+  uint16_t crc = crc16_ccitt(msg, len, 0);
 
-  uint8_t da;
-  uint8_t *ptr;
-  uint8_t b_crc_hign;
-  uint8_t b_crc_low;
-
-  uint16_t crc_ta[16] = {0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
-                         0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef};
-
-  ptr = msg;
-  crc = 0;
-
-  while (len-- != 0) {
-    da = ((uint8_t)(crc >> 8)) >> 4;
-    crc <<= 4;
-    crc ^= crc_ta[da ^ (*ptr >> 4)];
-    da = ((uint8_t)(crc >> 8)) >> 4;
-    crc <<= 4;
-    crc ^= crc_ta[da ^ (*ptr & 0x0f)];
-    ptr++;
-  }
-
-  b_crc_low = crc;
-  b_crc_hign = (uint8_t)(crc >> 8);
+  // The inverter doesn't accept CRC bytes that are framing characters, it expects them incremented
+  uint8_t b_crc_low = crc;
+  uint8_t b_crc_hign = (uint8_t)(crc >> 8);
 
   if (b_crc_low == 0x28 || b_crc_low == 0x0d || b_crc_low == 0x0a)
     b_crc_low++;
@@ -12,6 +12,8 @@ from esphome.cpp_types import EntityBase
 
 AUTO_LOAD = ["web_server_base"]
 
+CONF_LOOP_TIMING = "loop_timing"
+
 prometheus_ns = cg.esphome_ns.namespace("prometheus")
 PrometheusHandler = prometheus_ns.class_("PrometheusHandler", cg.Component)
 
@@ -30,6 +32,7 @@ CONFIG_SCHEMA = cv.Schema(
             web_server_base.WebServerBase
         ),
         cv.Optional(CONF_INCLUDE_INTERNAL, default=False): cv.boolean,
+        cv.Optional(CONF_LOOP_TIMING, default=False): cv.boolean,
         cv.Optional(CONF_RELABEL, default={}): cv.Schema(
             {
                 cv.use_id(EntityBase): CUSTOMIZED_ENTITY,
@@ -49,6 +52,9 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
+    if config[CONF_LOOP_TIMING]:
+        # Export a histogram of the main loop duration
+        cg.add_define("USE_LOOP_TIME_STATS")
 
     for key, value in config[CONF_RELABEL].items():
         entity = await cg.get_variable(key)
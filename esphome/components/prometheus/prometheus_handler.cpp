@@ -3,179 +3,313 @@
 #include "prometheus_handler.h"
 #include "esphome/core/application.h"
 
+#include <cstring>
+#include <memory>
+
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
-
+void PrometheusHandler::setup() {
+  // Entity ids and names don't change at runtime, so their labels are only built once
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
-
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
-
 #ifdef USE_LOCK
-  this->lock_type_(stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+    this->labels_map_[obj] = this->build_labels_(obj);
 #endif
 
-  req->send(stream);
+  this->base_->init();
+  this->base_->add_handler(this);
 }
 
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
-  auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
+#ifdef USE_LOOP_TIME_STATS
+void PrometheusHandler::loop() {
+  uint8_t next = 1 - this->loop_time_stats_active_.load(std::memory_order_relaxed);
+  this->loop_time_stats_[next] = App.get_loop_time_stats();
+  this->loop_time_stats_active_.store(next, std::memory_order_release);
+}
+#endif
+
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  // The metrics are rendered while the response is sent instead of buffering the whole body.
+  // Each request gets its own iterator, so concurrent scrapes don't interfere.
+  auto iterator = std::make_shared<PrometheusIterator>(this);
+  iterator->begin(this->include_internal_);
+  AsyncWebServerResponse *response =
+      req->beginChunkedResponse("text/plain; version=0.0.4; charset=utf-8",
+                                [iterator](uint8_t *buffer, size_t max_len, size_t index) -> size_t {
+                                  return iterator->fill(buffer, max_len);
+                                });
+  req->send(response);
+}
+
+static void append_label_value(std::string &out, const std::string &value) {
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      out += '\\';
+      out += c;
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+}
+
+std::string PrometheusHandler::build_labels_(EntityBase *obj) const {
+  auto id = this->relabel_map_id_.find(obj);
+  auto name = this->relabel_map_name_.find(obj);
+  std::string labels = "id=\"";
+  append_label_value(labels, id == this->relabel_map_id_.end() ? obj->get_object_id() : id->second);
+  labels += "\",name=\"";
+  append_label_value(labels, name == this->relabel_map_name_.end() ? obj->get_name() : name->second);
+  labels += '"';
+  return labels;
+}
+
+void PrometheusHandler::print_labels_(Print *stream, EntityBase *obj) const {
+  auto item = this->labels_map_.find(obj);
+  if (item != this->labels_map_.end()) {
+    stream->print(item->second.c_str());
+  } else {
+    // Entity registered after setup, the map isn't changed as this runs on the web server's task
+    stream->print(this->build_labels_(obj).c_str());
+  }
+}
+
+PrometheusIterator::PrometheusIterator(PrometheusHandler *handler) : handler_(handler) {}
+
+size_t PrometheusIterator::fill(uint8_t *buffer, size_t max_len) {
+  // Render entities until there's enough output for this chunk or all entities are done
+  while (this->out_.buffer.size() - this->out_pos_ < max_len && this->state_ != IteratorState::NONE)
+    this->advance();
+  size_t len = std::min(max_len, this->out_.buffer.size() - this->out_pos_);
+  memcpy(buffer, this->out_.buffer.data() + this->out_pos_, len);
+  this->out_pos_ += len;
+  if (this->out_pos_ == this->out_.buffer.size()) {
+    this->out_.buffer.clear();
+    this->out_pos_ = 0;
+  }
+  return len;
+}
+
+bool PrometheusIterator::first_of_domain_() {
+  if (this->typed_ == this->state_)
+    return false;
+  this->typed_ = this->state_;
+  return true;
+}
+
+#ifdef USE_SENSOR
+bool PrometheusIterator::on_sensor(sensor::Sensor *sensor) {
+  if (this->first_of_domain_())
+    this->handler_->sensor_type_(&this->out_);
+  this->handler_->sensor_row_(&this->out_, sensor);
+  return true;
+}
+#endif
+#ifdef USE_BINARY_SENSOR
+bool PrometheusIterator::on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
+  if (this->first_of_domain_())
+    this->handler_->binary_sensor_type_(&this->out_);
+  this->handler_->binary_sensor_row_(&this->out_, binary_sensor);
+  return true;
+}
+#endif
+#ifdef USE_FAN
+bool PrometheusIterator::on_fan(fan::Fan *fan) {
+  if (this->first_of_domain_())
+    this->handler_->fan_type_(&this->out_);
+  this->handler_->fan_row_(&this->out_, fan);
+  return true;
+}
+#endif
+#ifdef USE_LIGHT
+bool PrometheusIterator::on_light(light::LightState *light) {
+  if (this->first_of_domain_())
+    this->handler_->light_type_(&this->out_);
+  this->handler_->light_row_(&this->out_, light);
+  return true;
+}
+#endif
+#ifdef USE_COVER
+bool PrometheusIterator::on_cover(cover::Cover *cover) {
+  if (this->first_of_domain_())
+    this->handler_->cover_type_(&this->out_);
+  this->handler_->cover_row_(&this->out_, cover);
+  return true;
+}
+#endif
+#ifdef USE_SWITCH
+bool PrometheusIterator::on_switch(switch_::Switch *a_switch) {
+  if (this->first_of_domain_())
+    this->handler_->switch_type_(&this->out_);
+  this->handler_->switch_row_(&this->out_, a_switch);
+  return true;
+}
+#endif
+#ifdef USE_LOCK
+bool PrometheusIterator::on_lock(lock::Lock *a_lock) {
+  if (this->first_of_domain_())
+    this->handler_->lock_type_(&this->out_);
+  this->handler_->lock_row_(&this->out_, a_lock);
+  return true;
+}
+#endif
+// Domains without metrics
+#ifdef USE_BUTTON
+bool PrometheusIterator::on_button(button::Button *button) { return true; }
+#endif
+#ifdef USE_TEXT_SENSOR
+bool PrometheusIterator::on_text_sensor(text_sensor::TextSensor *text_sensor) { return true; }
+#endif
+#ifdef USE_CLIMATE
+bool PrometheusIterator::on_climate(climate::Climate *climate) { return true; }
+#endif
+#ifdef USE_NUMBER
+bool PrometheusIterator::on_number(number::Number *number) { return true; }
+#endif
+#ifdef USE_SELECT
+bool PrometheusIterator::on_select(select::Select *select) { return true; }
+#endif
+bool PrometheusIterator::on_end() {
+#ifdef USE_LOOP_TIME_STATS
+  this->handler_->loop_time_rows_(&this->out_);
+#endif
+  return true;
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
-  auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
+#ifdef USE_LOOP_TIME_STATS
+void PrometheusHandler::loop_time_rows_(Print *stream) {
+  const LoopTimeStats stats = this->loop_time_stats_[this->loop_time_stats_active_.load(std::memory_order_acquire)];
+  stream->print(F("#TYPE esphome_loop_duration_seconds HISTOGRAM\n"));
+  uint32_t cumulative = 0;
+  for (size_t i = 0; i < LoopTimeStats::BUCKET_COUNT; i++) {
+    cumulative += stats.buckets[i];
+    stream->print(F("esphome_loop_duration_seconds_bucket{le=\""));
+    stream->print(LoopTimeStats::BUCKET_BOUNDS_US[i] / 1e6f, 3);
+    stream->print(F("\"} "));
+    stream->print(cumulative);
+    stream->print('\n');
+  }
+  stream->print(F("esphome_loop_duration_seconds_bucket{le=\"+Inf\"} "));
+  stream->print(stats.count);
+  stream->print(F("\nesphome_loop_duration_seconds_sum "));
+  stream->print(stats.sum_us / 1e6, 6);
+  stream->print(F("\nesphome_loop_duration_seconds_count "));
+  stream->print(stats.count);
+  stream->print('\n');
 }
+#endif
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::sensor_type_(Print *stream) {
   stream->print(F("#TYPE esphome_sensor_value GAUGE\n"));
   stream->print(F("#TYPE esphome_sensor_failed GAUGE\n"));
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::sensor_row_(Print *stream, sensor::Sensor *obj) {
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    stream->print(F("esphome_sensor_failed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} 0\n"));
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
+    stream->print(F("esphome_sensor_value{"));
+    this->print_labels_(stream, obj);
+    stream->print(F(",unit=\""));
     stream->print(obj->get_unit_of_measurement().c_str());
     stream->print(F("\"} "));
     stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
     stream->print('\n');
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    stream->print(F("esphome_sensor_failed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} 1\n"));
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::binary_sensor_type_(Print *stream) {
   stream->print(F("#TYPE esphome_binary_sensor_value GAUGE\n"));
   stream->print(F("#TYPE esphome_binary_sensor_failed GAUGE\n"));
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::binary_sensor_row_(Print *stream, binary_sensor::BinarySensor *obj) {
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    stream->print(F("esphome_binary_sensor_failed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} 0\n"));
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_binary_sensor_value{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} "));
     stream->print(obj->state);
     stream->print('\n');
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    stream->print(F("esphome_binary_sensor_failed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::fan_type_(Print *stream) {
   stream->print(F("#TYPE esphome_fan_value GAUGE\n"));
   stream->print(F("#TYPE esphome_fan_failed GAUGE\n"));
   stream->print(F("#TYPE esphome_fan_speed GAUGE\n"));
   stream->print(F("#TYPE esphome_fan_oscillation GAUGE\n"));
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::fan_row_(Print *stream, fan::Fan *obj) {
+  stream->print(F("esphome_fan_failed{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} 0\n"));
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_fan_value{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} "));
   stream->print(obj->state);
   stream->print('\n');
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_fan_speed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} "));
     stream->print(obj->speed);
     stream->print('\n');
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_fan_oscillation{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} "));
     stream->print(obj->oscillating);
     stream->print('\n');
   }
@@ -183,20 +317,16 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::light_type_(Print *stream) {
   stream->print(F("#TYPE esphome_light_state GAUGE\n"));
   stream->print(F("#TYPE esphome_light_color GAUGE\n"));
   stream->print(F("#TYPE esphome_light_effect_active GAUGE\n"));
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::light_row_(Print *stream, light::LightState *obj) {
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_light_state{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} "));
   stream->print(obj->remote_values.is_on());
   stream->print(F("\n"));
   // Brightness and RGBW
@@ -204,55 +334,41 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
+  stream->print(F("esphome_light_color{"));
+  this->print_labels_(stream, obj);
+  stream->print(F(",channel=\"brightness\"} "));
   stream->print(brightness);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
+  stream->print(F("esphome_light_color{"));
+  this->print_labels_(stream, obj);
+  stream->print(F(",channel=\"r\"} "));
   stream->print(r);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
+  stream->print(F("esphome_light_color{"));
+  this->print_labels_(stream, obj);
+  stream->print(F(",channel=\"g\"} "));
   stream->print(g);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
+  stream->print(F("esphome_light_color{"));
+  this->print_labels_(stream, obj);
+  stream->print(F(",channel=\"b\"} "));
   stream->print(b);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
+  stream->print(F("esphome_light_color{"));
+  this->print_labels_(stream, obj);
+  stream->print(F(",channel=\"w\"} "));
   stream->print(w);
   stream->print(F("\n"));
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    stream->print(F("esphome_light_effect_active{"));
+    this->print_labels_(stream, obj);
+    stream->print(F(",effect=\"None\"} 0\n"));
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
+    stream->print(F("esphome_light_effect_active{"));
+    this->print_labels_(stream, obj);
+    stream->print(F(",effect=\""));
     stream->print(effect.c_str());
     stream->print(F("\"} 1\n"));
   }
@@ -260,91 +376,69 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::cover_type_(Print *stream) {
   stream->print(F("#TYPE esphome_cover_value GAUGE\n"));
   stream->print(F("#TYPE esphome_cover_failed GAUGE\n"));
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::cover_row_(Print *stream, cover::Cover *obj) {
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    stream->print(F("esphome_cover_failed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} 0\n"));
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_cover_value{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} "));
     stream->print(obj->position);
     stream->print('\n');
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
+      stream->print(F("esphome_cover_tilt{"));
+      this->print_labels_(stream, obj);
+      stream->print(F("} "));
       stream->print(obj->tilt);
       stream->print('\n');
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    stream->print(F("esphome_cover_failed{"));
+    this->print_labels_(stream, obj);
+    stream->print(F("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::switch_type_(Print *stream) {
   stream->print(F("#TYPE esphome_switch_value GAUGE\n"));
   stream->print(F("#TYPE esphome_switch_failed GAUGE\n"));
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::switch_row_(Print *stream, switch_::Switch *obj) {
+  stream->print(F("esphome_switch_failed{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} 0\n"));
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_switch_value{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} "));
   stream->print(obj->state);
   stream->print('\n');
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::lock_type_(Print *stream) {
   stream->print(F("#TYPE esphome_lock_value GAUGE\n"));
   stream->print(F("#TYPE esphome_lock_failed GAUGE\n"));
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::lock_row_(Print *stream, lock::Lock *obj) {
+  stream->print(F("esphome_lock_failed{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} 0\n"));
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_lock_value{"));
+  this->print_labels_(stream, obj);
+  stream->print(F("} "));
   stream->print(obj->state);
   stream->print('\n');
 }
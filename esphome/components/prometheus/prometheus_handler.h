@@ -2,16 +2,98 @@
 
 #ifdef USE_ARDUINO
 
+#include <atomic>
 #include <map>
+#include <string>
 #include <utility>
 
 #include "esphome/components/web_server_base/web_server_base.h"
+#include "esphome/core/application.h"
 #include "esphome/core/controller.h"
 #include "esphome/core/component.h"
+#include "esphome/core/component_iterator.h"
 
 namespace esphome {
 namespace prometheus {
 
+class PrometheusHandler;
+
+/// Print that collects the rendered metrics until the chunked response takes them.
+class StringPrint : public Print {
+ public:
+  size_t write(uint8_t c) override {
+    this->buffer.push_back(static_cast<char>(c));
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) override {
+    this->buffer.append(reinterpret_cast<const char *>(data), len);
+    return len;
+  }
+
+  std::string buffer;
+};
+
+/// Renders the metrics of one scrape, one entity at a time.
+class PrometheusIterator : public ComponentIterator {
+ public:
+  PrometheusIterator(PrometheusHandler *handler);
+
+  /** Fill the next chunk of the response.
+   *
+   * @param buffer The buffer to write the chunk to.
+   * @param max_len The size of the buffer.
+   * @return The length of the chunk, 0 once all metrics were sent.
+   */
+  size_t fill(uint8_t *buffer, size_t max_len);
+
+#ifdef USE_BINARY_SENSOR
+  bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) override;
+#endif
+#ifdef USE_COVER
+  bool on_cover(cover::Cover *cover) override;
+#endif
+#ifdef USE_FAN
+  bool on_fan(fan::Fan *fan) override;
+#endif
+#ifdef USE_LIGHT
+  bool on_light(light::LightState *light) override;
+#endif
+#ifdef USE_SENSOR
+  bool on_sensor(sensor::Sensor *sensor) override;
+#endif
+#ifdef USE_SWITCH
+  bool on_switch(switch_::Switch *a_switch) override;
+#endif
+#ifdef USE_BUTTON
+  bool on_button(button::Button *button) override;
+#endif
+#ifdef USE_TEXT_SENSOR
+  bool on_text_sensor(text_sensor::TextSensor *text_sensor) override;
+#endif
+#ifdef USE_CLIMATE
+  bool on_climate(climate::Climate *climate) override;
+#endif
+#ifdef USE_NUMBER
+  bool on_number(number::Number *number) override;
+#endif
+#ifdef USE_SELECT
+  bool on_select(select::Select *select) override;
+#endif
+#ifdef USE_LOCK
+  bool on_lock(lock::Lock *a_lock) override;
+#endif
+  bool on_end() override;
+
+ protected:
+  /// Whether this is the first entity of its domain, which is preceded by the type lines of the domain.
+  bool first_of_domain_();
+
+  PrometheusHandler *handler_;
+  StringPrint out_;
+  size_t out_pos_{0};
+  IteratorState typed_{IteratorState::NONE};
+};
+
 class PrometheusHandler : public AsyncWebHandler, public Component {
  public:
   PrometheusHandler(web_server_base::WebServerBase *base) : base_(base) {}
@@ -48,72 +130,89 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
+#ifdef USE_LOOP_TIME_STATS
+  void loop() override;
+#endif
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
-  std::string relabel_id_(EntityBase *obj);
-  std::string relabel_name_(EntityBase *obj);
+  friend PrometheusIterator;
+
+  /// Build the id and name labels of an entity, for example `id="living_room",name="Living Room"`.
+  std::string build_labels_(EntityBase *obj) const;
+  /// Print the labels of an entity, which are shared by all of its metrics.
+  void print_labels_(Print *stream, EntityBase *obj) const;
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(Print *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(Print *stream, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(Print *stream);
   /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(Print *stream, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(Print *stream);
   /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  void fan_row_(Print *stream, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(Print *stream);
   /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(Print *stream, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(Print *stream);
   /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(Print *stream, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(Print *stream);
   /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(Print *stream, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(Print *stream);
   /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  void lock_row_(Print *stream, lock::Lock *obj);
+#endif
+
+#ifdef USE_LOOP_TIME_STATS
+  /// Return the histogram of the main loop duration
+  void loop_time_rows_(Print *stream);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  /// The labels of all entities, built in setup(). Only read afterwards, as requests are handled on another task.
+  std::map<EntityBase *, std::string> labels_map_;
+#ifdef USE_LOOP_TIME_STATS
+  /// Copies of the loop time stats, taken in loop() as requests are handled on another task. loop() writes the one
+  /// that isn't active and then makes it the active one.
+  LoopTimeStats loop_time_stats_[2]{};
+  std::atomic<uint8_t> loop_time_stats_active_{0};
+#endif
 };
 
 }  // namespace prometheus
@@ -11,6 +11,7 @@ struct DishData {
 
   bool operator==(const DishData &rhs) const { return address == rhs.address && command == rhs.command; }
 };
+inline uint32_t remote_data_key(const DishData &data) { return (uint32_t(data.address) << 8) | data.command; }
 
 class DishProtocol : public RemoteProtocol<DishData> {
  public:
@@ -10,6 +10,7 @@ struct JVCData {
 
   bool operator==(const JVCData &rhs) const { return data == rhs.data; }
 };
+inline uint32_t remote_data_key(const JVCData &data) { return data.data; }
 
 class JVCProtocol : public RemoteProtocol<JVCData> {
  public:
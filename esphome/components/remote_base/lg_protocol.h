@@ -12,6 +12,7 @@ struct LGData {
 
   bool operator==(const LGData &rhs) const { return data == rhs.data && nbits == rhs.nbits; }
 };
+inline uint32_t remote_data_key(const LGData &data) { return data.data; }
 
 class LGProtocol : public RemoteProtocol<LGData> {
  public:
@@ -23,6 +23,8 @@ struct MagiQuestData {
     return (this->wand_id == 0xffff || rhs.wand_id == 0xffff || this->wand_id == rhs.wand_id);
   }
 };
+// operator== only compares the wand id
+inline uint32_t remote_data_key(const MagiQuestData &data) { return data.wand_id; }
 
 class MagiQuestProtocol : public RemoteProtocol<MagiQuestData> {
  public:
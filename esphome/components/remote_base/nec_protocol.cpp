@@ -66,6 +66,42 @@ optional<NECData> NECProtocol::decode(RemoteReceiveData src) {
   src.expect_mark(BIT_HIGH_US);
   return data;
 }
+optional<NECData> NECPulseDecoder::feed(int32_t pulse, uint8_t tolerance) {
+  // Header mark and space, then a mark and a space for each of the 32 bits
+  static const uint8_t FRAME_PULSES = 2 + 2 * 32;
+
+  if (this->pulse_ == 0) {
+    if (!is_mark_(pulse, HEADER_HIGH_US, tolerance))
+      return {};
+    this->data_.address = 0;
+    this->data_.command = 0;
+  } else if (this->pulse_ == 1) {
+    if (!is_space_(pulse, HEADER_LOW_US, tolerance)) {
+      this->pulse_ = 0;
+      return this->feed(pulse, tolerance);
+    }
+  } else if (this->pulse_ % 2 == 0) {
+    if (!is_mark_(pulse, BIT_HIGH_US, tolerance)) {
+      this->pulse_ = 0;
+      return this->feed(pulse, tolerance);
+    }
+  } else {
+    const uint8_t bit = (this->pulse_ - 3) / 2;
+    uint16_t &value = bit < 16 ? this->data_.address : this->data_.command;
+    if (is_space_(pulse, BIT_ONE_LOW_US, tolerance)) {
+      value |= 1 << (bit % 16);
+    } else if (!is_space_(pulse, BIT_ZERO_LOW_US, tolerance)) {
+      this->pulse_ = 0;
+      return this->feed(pulse, tolerance);
+    }
+  }
+
+  if (++this->pulse_ < FRAME_PULSES)
+    return {};
+  // Like decode(), the trailing mark isn't needed
+  this->pulse_ = 0;
+  return this->data_;
+}
 void NECProtocol::dump(const NECData &data) {
   ESP_LOGD(TAG, "Received NEC: address=0x%04X, command=0x%04X", data.address, data.command);
 }
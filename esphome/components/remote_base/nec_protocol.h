@@ -11,6 +11,7 @@ struct NECData {
 
   bool operator==(const NECData &rhs) const { return address == rhs.address && command == rhs.command; }
 };
+inline uint32_t remote_data_key(const NECData &data) { return (uint32_t(data.address) << 16) | data.command; }
 
 class NECProtocol : public RemoteProtocol<NECData> {
  public:
@@ -21,6 +22,22 @@ class NECProtocol : public RemoteProtocol<NECData> {
 
 DECLARE_REMOTE_PROTOCOL(NEC)
 
+/// Recognizes NEC frames pulse by pulse, as soon as the space of the last bit is received.
+class NECPulseDecoder : public RemotePulseDecoder<NECData> {
+ public:
+  optional<NECData> feed(int32_t pulse, uint8_t tolerance) override;
+  void reset() override { this->pulse_ = 0; }
+
+ protected:
+  /// Number of pulses of the current frame received so far
+  uint8_t pulse_{0};
+  NECData data_{};
+};
+
+template<> inline RemotePulseDecoder<NECData> *make_remote_pulse_decoder<NECProtocol, NECData>() {
+  return new NECPulseDecoder();  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
 template<typename... Ts> class NECAction : public RemoteTransmitterActionBase<Ts...> {
  public:
   TEMPLATABLE_VALUE(uint16_t, address)
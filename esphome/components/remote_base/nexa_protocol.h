@@ -16,6 +16,7 @@ struct NexaData {
            level == rhs.level;
   }
 };
+inline uint32_t remote_data_key(const NexaData &data) { return data.device ^ (uint32_t(data.channel) << 24); }
 
 class NexaProtocol : public RemoteProtocol<NexaData> {
  public:
@@ -12,6 +12,7 @@ struct PanasonicData {
 
   bool operator==(const PanasonicData &rhs) const { return address == rhs.address && command == rhs.command; }
 };
+inline uint32_t remote_data_key(const PanasonicData &data) { return (uint32_t(data.address) << 16) ^ data.command; }
 
 class PanasonicProtocol : public RemoteProtocol<PanasonicData> {
  public:
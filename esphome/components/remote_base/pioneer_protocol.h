@@ -11,6 +11,7 @@ struct PioneerData {
 
   bool operator==(const PioneerData &rhs) const { return rc_code_1 == rhs.rc_code_1 && rc_code_2 == rhs.rc_code_2; }
 };
+inline uint32_t remote_data_key(const PioneerData &data) { return (uint32_t(data.rc_code_1) << 16) | data.rc_code_2; }
 
 class PioneerProtocol : public RemoteProtocol<PioneerData> {
  public:
@@ -12,6 +12,7 @@ struct RC5Data {
 
   bool operator==(const RC5Data &rhs) const { return address == rhs.address && command == rhs.command; }
 };
+inline uint32_t remote_data_key(const RC5Data &data) { return (uint32_t(data.address) << 8) | data.command; }
 
 class RC5Protocol : public RemoteProtocol<RC5Data> {
  public:
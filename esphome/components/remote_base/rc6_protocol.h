@@ -13,6 +13,7 @@ struct RC6Data {
 
   bool operator==(const RC6Data &rhs) const { return address == rhs.address && command == rhs.command; }
 };
+inline uint32_t remote_data_key(const RC6Data &data) { return (uint32_t(data.address) << 8) | data.command; }
 
 class RC6Protocol : public RemoteProtocol<RC6Data> {
  public:
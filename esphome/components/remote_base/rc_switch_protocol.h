@@ -12,6 +12,7 @@ struct RCSwitchData {
 
   bool operator==(const RCSwitchData &rhs) const { return code == rhs.code && protocol == rhs.protocol; }
 };
+inline uint32_t remote_data_key(const RCSwitchData &data) { return uint32_t(data.code) ^ uint32_t(data.code >> 32); }
 
 class RCSwitchBase {
  public:
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <utility>
 
 #pragma once
@@ -145,6 +146,34 @@ class RemoteReceiveData {
   uint8_t tolerance_;
 };
 
+/// Incremental decoder of a protocol, fed the pulses of the receiver one at a time as they arrive. Protocols can
+/// provide one by specializing make_remote_pulse_decoder(), their frames are then recognized as soon as the last
+/// pulse is received instead of after the receiver went idle.
+template<typename D> class RemotePulseDecoder {
+ public:
+  /// Feed the next pulse (positive for a mark, negative for a space). Returns the decoded value when it completed a
+  /// frame, the decoder then waits for the start of the next frame.
+  virtual optional<D> feed(int32_t pulse, uint8_t tolerance) = 0;
+  /// The receiver went idle, start over with the next pulse.
+  virtual void reset() = 0;
+
+ protected:
+  static bool is_mark_(int32_t pulse, uint32_t length, uint8_t tolerance) {
+    return pulse >= 0 && in_tolerance_(pulse, length, tolerance);
+  }
+  static bool is_space_(int32_t pulse, uint32_t length, uint8_t tolerance) {
+    return pulse <= 0 && in_tolerance_(-pulse, length, tolerance);
+  }
+  static bool in_tolerance_(int32_t value, uint32_t length, uint8_t tolerance) {
+    const int32_t lo = int32_t(100 - tolerance) * length / 100U;
+    const int32_t hi = int32_t(100 + tolerance) * length / 100U;
+    return lo <= value && value <= hi;
+  }
+};
+
+/// Protocols without a pulse decoder are decoded from the whole frame.
+template<typename T, typename D> RemotePulseDecoder<D> *make_remote_pulse_decoder() { return nullptr; }
+
 template<typename T> class RemoteProtocol {
  public:
   virtual void encode(RemoteTransmitData *dst, const T &data) = 0;
@@ -223,6 +252,19 @@ class RemoteReceiverListener {
   virtual bool on_receive(RemoteReceiveData data) = 0;
 };
 
+/// Listener fed the pulses of a frame one at a time, see RemotePulseDecoder.
+class RemoteReceiverPulseListener {
+ public:
+  /// Returns true when the pulse completed a frame that was handled.
+  virtual bool on_pulse(int32_t pulse, uint8_t tolerance) = 0;
+  /// The receiver went idle, the next pulse starts a new frame.
+  virtual void on_idle() = 0;
+};
+
+template<typename T, typename D> class RemoteReceiverBinarySensor;
+template<typename T, typename D> class RemoteReceiverTrigger;
+template<typename T, typename D> class RemoteReceiverProtocolListener;
+
 class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
@@ -233,6 +275,9 @@ class RemoteReceiverBase : public RemoteComponentBase {
  public:
   RemoteReceiverBase(InternalGPIOPin *pin) : RemoteComponentBase(pin) {}
   void register_listener(RemoteReceiverListener *listener) { this->listeners_.push_back(listener); }
+  /// Binary sensors and triggers of a protocol share one listener that decodes each frame only once.
+  template<typename T, typename D> void register_listener(RemoteReceiverBinarySensor<T, D> *binary_sensor);
+  template<typename T, typename D> void register_listener(RemoteReceiverTrigger<T, D> *trigger);
   void register_dumper(RemoteReceiverDumperBase *dumper) {
     if (dumper->is_secondary()) {
       this->secondary_dumpers_.push_back(dumper);
@@ -243,8 +288,26 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void set_tolerance(uint8_t tolerance) { tolerance_ = tolerance; }
 
  protected:
+  /// Feed one pulse of the current frame to the pulse listeners, for receivers that stream the pulses as they arrive.
+  void call_pulse_listeners_(int32_t pulse) {
+    for (auto *listener : this->pulse_listeners_) {
+      if (listener->on_pulse(pulse, this->tolerance_))
+        this->pulse_handled_ = true;
+    }
+  }
+  void reset_pulse_listeners_() {
+    for (auto *listener : this->pulse_listeners_)
+      listener->on_idle();
+  }
   bool call_listeners_() {
-    bool success = false;
+    if (!this->streams_pulses_) {
+      // The receiver only has whole frames, hand the pulse listeners the frame now
+      for (int32_t pulse : this->temp_)
+        this->call_pulse_listeners_(pulse);
+      this->reset_pulse_listeners_();
+    }
+    bool success = this->pulse_handled_;
+    this->pulse_handled_ = false;
     for (auto *listener : this->listeners_) {
       auto data = RemoteReceiveData(&this->temp_, this->tolerance_);
       if (listener->on_receive(data))
@@ -272,12 +335,20 @@ class RemoteReceiverBase : public RemoteComponentBase {
     // If a listener handled, then do not dump
     this->call_dumpers_();
   }
+  template<typename T, typename D> RemoteReceiverProtocolListener<T, D> *get_protocol_listener_();
 
   std::vector<RemoteReceiverListener *> listeners_;
+  std::vector<RemoteReceiverPulseListener *> pulse_listeners_;
+  /// The protocol listeners in listeners_, by the address of their TYPE_ID
+  std::vector<std::pair<const void *, RemoteReceiverListener *>> protocol_listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   std::vector<int32_t> temp_;
   uint8_t tolerance_{25};
+  /// Set by receivers that call call_pulse_listeners_() themselves while the frame is received
+  bool streams_pulses_{false};
+  /// A pulse listener handled the current frame
+  bool pulse_handled_{false};
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -289,13 +360,17 @@ class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitial
   virtual bool matches(RemoteReceiveData src) = 0;
   bool on_receive(RemoteReceiveData src) override {
     if (this->matches(src)) {
-      this->publish_state(true);
-      yield();
-      this->publish_state(false);
+      this->publish_match();
       return true;
     }
     return false;
   }
+  /// Publish a short ON pulse for a received frame that matched.
+  void publish_match() {
+    this->publish_state(true);
+    yield();
+    this->publish_state(false);
+  }
 };
 
 template<typename T, typename D> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
@@ -311,6 +386,7 @@ template<typename T, typename D> class RemoteReceiverBinarySensor : public Remot
 
  public:
   void set_data(D data) { data_ = data; }
+  const D &get_data() const { return data_; }
 
  protected:
   D data_;
@@ -329,6 +405,109 @@ template<typename T, typename D> class RemoteReceiverTrigger : public Trigger<D>
   }
 };
 
+/// Key of a decoded value to look up the binary sensors expecting it. Values that compare equal must have the
+/// same key, protocols without an overload put all their binary sensors under one key and compare each of them.
+template<typename D> uint32_t remote_data_key(const D &data) { return 0; }
+inline uint32_t remote_data_key(uint32_t data) { return data; }
+
+/// All binary sensors and triggers of one protocol on a receiver. A frame is decoded once for all of them and the
+/// binary sensors are looked up by the key of the decoded value, so that a remote with many buttons costs one
+/// decode per frame instead of one per button. Protocols with a pulse decoder are decoded while the frame arrives.
+template<typename T, typename D>
+class RemoteReceiverProtocolListener : public RemoteReceiverListener, public RemoteReceiverPulseListener {
+ public:
+  /// Only its address is used, to find the listener of a protocol on the receiver.
+  static const uint8_t TYPE_ID;
+
+  void add_binary_sensor(RemoteReceiverBinarySensor<T, D> *binary_sensor) {
+    this->binary_sensors_.emplace_back(0, binary_sensor);
+    this->sorted_ = false;
+  }
+  void add_trigger(RemoteReceiverTrigger<T, D> *trigger) { this->triggers_.push_back(trigger); }
+
+  bool is_streaming() const { return this->pulse_decoder_ != nullptr; }
+
+  bool on_receive(RemoteReceiveData src) override {
+    auto proto = T();
+    auto res = proto.decode(src);
+    if (!res.has_value())
+      return false;
+    return this->dispatch_(*res);
+  }
+  bool on_pulse(int32_t pulse, uint8_t tolerance) override {
+    auto res = this->pulse_decoder_->feed(pulse, tolerance);
+    if (!res.has_value())
+      return false;
+    return this->dispatch_(*res);
+  }
+  void on_idle() override { this->pulse_decoder_->reset(); }
+
+ protected:
+  bool dispatch_(const D &res) {
+    for (auto *trigger : this->triggers_)
+      trigger->trigger(res);
+
+    bool success = !this->triggers_.empty();
+    if (!this->sorted_)
+      this->sort_binary_sensors_();
+    uint32_t key = remote_data_key(res);
+    auto it = std::lower_bound(this->binary_sensors_.begin(), this->binary_sensors_.end(), key,
+                               [](const std::pair<uint32_t, RemoteReceiverBinarySensor<T, D> *> &entry,
+                                  uint32_t key) { return entry.first < key; });
+    for (; it != this->binary_sensors_.end() && it->first == key; ++it) {
+      if (res == it->second->get_data()) {
+        it->second->publish_match();
+        success = true;
+      }
+    }
+    return success;
+  }
+
+  /// The data of the binary sensors is set after they are registered, so the keys are computed on the first frame.
+  void sort_binary_sensors_() {
+    for (auto &entry : this->binary_sensors_)
+      entry.first = remote_data_key(entry.second->get_data());
+    std::stable_sort(this->binary_sensors_.begin(), this->binary_sensors_.end(),
+                     [](const std::pair<uint32_t, RemoteReceiverBinarySensor<T, D> *> &a,
+                        const std::pair<uint32_t, RemoteReceiverBinarySensor<T, D> *> &b) { return a.first < b.first; });
+    this->sorted_ = true;
+  }
+
+  /// Sorted by key once sorted_ is set
+  std::vector<std::pair<uint32_t, RemoteReceiverBinarySensor<T, D> *>> binary_sensors_;
+  std::vector<RemoteReceiverTrigger<T, D> *> triggers_;
+  RemotePulseDecoder<D> *pulse_decoder_{make_remote_pulse_decoder<T, D>()};
+  bool sorted_{true};
+};
+
+template<typename T, typename D> const uint8_t RemoteReceiverProtocolListener<T, D>::TYPE_ID = 0;
+
+template<typename T, typename D>
+RemoteReceiverProtocolListener<T, D> *RemoteReceiverBase::get_protocol_listener_() {
+  const void *type_id = &RemoteReceiverProtocolListener<T, D>::TYPE_ID;
+  for (auto &entry : this->protocol_listeners_) {
+    if (entry.first == type_id)
+      return static_cast<RemoteReceiverProtocolListener<T, D> *>(entry.second);
+  }
+  auto *listener = new RemoteReceiverProtocolListener<T, D>();  // NOLINT(cppcoreguidelines-owning-memory)
+  this->protocol_listeners_.emplace_back(type_id, listener);
+  if (listener->is_streaming()) {
+    this->pulse_listeners_.push_back(listener);
+  } else {
+    this->listeners_.push_back(listener);
+  }
+  return listener;
+}
+
+template<typename T, typename D>
+void RemoteReceiverBase::register_listener(RemoteReceiverBinarySensor<T, D> *binary_sensor) {
+  this->get_protocol_listener_<T, D>()->add_binary_sensor(binary_sensor);
+}
+
+template<typename T, typename D> void RemoteReceiverBase::register_listener(RemoteReceiverTrigger<T, D> *trigger) {
+  this->get_protocol_listener_<T, D>()->add_trigger(trigger);
+}
+
 template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...> {
  public:
   void set_parent(RemoteTransmitterBase *parent) { this->parent_ = parent; }
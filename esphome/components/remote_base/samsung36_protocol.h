@@ -12,6 +12,7 @@ struct Samsung36Data {
 
   bool operator==(const Samsung36Data &rhs) const { return address == rhs.address && command == rhs.command; }
 };
+inline uint32_t remote_data_key(const Samsung36Data &data) { return (uint32_t(data.address) << 16) ^ data.command; }
 
 class Samsung36Protocol : public RemoteProtocol<Samsung36Data> {
  public:
@@ -12,6 +12,7 @@ struct SamsungData {
 
   bool operator==(const SamsungData &rhs) const { return data == rhs.data && nbits == rhs.nbits; }
 };
+inline uint32_t remote_data_key(const SamsungData &data) { return uint32_t(data.data) ^ uint32_t(data.data >> 32); }
 
 class SamsungProtocol : public RemoteProtocol<SamsungData> {
  public:
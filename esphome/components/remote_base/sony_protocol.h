@@ -12,6 +12,7 @@ struct SonyData {
 
   bool operator==(const SonyData &rhs) const { return data == rhs.data && nbits == rhs.nbits; }
 };
+inline uint32_t remote_data_key(const SonyData &data) { return data.data; }
 
 class SonyProtocol : public RemoteProtocol<SonyData> {
  public:
@@ -12,6 +12,9 @@ struct ToshibaAcData {
 
   bool operator==(const ToshibaAcData &rhs) const { return rc_code_1 == rhs.rc_code_1 && rc_code_2 == rhs.rc_code_2; }
 };
+inline uint32_t remote_data_key(const ToshibaAcData &data) {
+  return uint32_t(data.rc_code_1) ^ uint32_t(data.rc_code_1 >> 32);
+}
 
 class ToshibaAcProtocol : public RemoteProtocol<ToshibaAcData> {
  public:
@@ -56,8 +56,12 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase,
 #endif
 
 #ifdef USE_ESP8266
+  void stream_pulses_(uint32_t write_at);
+
   RemoteReceiverComponentStore store_;
   HighFrequencyLoopRequester high_freq_;
+  /// The last edge passed to the pulse listeners
+  uint32_t stream_at_{0};
 #endif
 
   uint32_t buffer_size_{};
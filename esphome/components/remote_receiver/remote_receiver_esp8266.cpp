@@ -54,6 +54,8 @@ void RemoteReceiverComponent::setup() {
   } else {
     s.buffer_write_at = s.buffer_read_at = 0;
   }
+  this->stream_at_ = s.buffer_write_at;
+  this->streams_pulses_ = true;
   this->pin_->attach_interrupt(RemoteReceiverComponentStore::gpio_intr, &this->store_, gpio::INTERRUPT_ANY_EDGE);
 }
 void RemoteReceiverComponent::dump_config() {
@@ -74,6 +76,8 @@ void RemoteReceiverComponent::loop() {
 
   // copy write at to local variables, as it's volatile
   const uint32_t write_at = s.buffer_write_at;
+  if (!this->pulse_listeners_.empty())
+    this->stream_pulses_(write_at);
   const uint32_t dist = (s.buffer_size + write_at - s.buffer_read_at) % s.buffer_size;
   // signals must at least one rising and one leading edge
   if (dist <= 1)
@@ -87,6 +91,13 @@ void RemoteReceiverComponent::loop() {
   ESP_LOGVV(TAG, "read_at=%u write_at=%u dist=%u now=%u end=%u", s.buffer_read_at, write_at, dist, now,
             s.buffer[write_at]);
 
+  if (this->listeners_.empty() && this->dumpers_.empty() && this->secondary_dumpers_.empty()) {
+    // Only pulse listeners, they have already seen the frame
+    s.buffer_read_at = write_at;
+    this->pulse_handled_ = false;
+    return;
+  }
+
   // Skip first value, it's from the previous idle level
   s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
   uint32_t prev = s.buffer_read_at;
@@ -116,6 +127,22 @@ void RemoteReceiverComponent::loop() {
   this->call_listeners_dumpers_();
 }
 
+void RemoteReceiverComponent::stream_pulses_(uint32_t write_at) {
+  auto &s = this->store_;
+  while (this->stream_at_ != write_at) {
+    const uint32_t next = (this->stream_at_ + 1) % s.buffer_size;
+    const uint32_t delta = s.buffer[next] - s.buffer[this->stream_at_];
+    this->stream_at_ = next;
+    if (delta >= this->idle_us_) {
+      // The pulse before the first edge of a frame is the idle level
+      this->reset_pulse_listeners_();
+      continue;
+    }
+    // Same signs as the frame built in loop()
+    this->call_pulse_listeners_(next % 2 == 0 ? int32_t(delta) : -int32_t(delta));
+  }
+}
+
 }  // namespace remote_receiver
 }  // namespace esphome
 
@@ -28,6 +28,8 @@ optional<RuuviParseResult> parse_ruuvi(const esp32_ble_tracker::ESPBTDevice &dev
 
 class RuuviListener : public esp32_ble_tracker::ESPBTDeviceListener {
  public:
+  // Ruuvi Innovations company id
+  RuuviListener() { this->add_device_filter_manufacturer_id(0x0499); }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
 };
 
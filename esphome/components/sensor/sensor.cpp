@@ -23,15 +23,25 @@ std::string state_class_to_string(StateClass state_class) {
 Sensor::Sensor(const std::string &name) : EntityBase(name), state(NAN), raw_state(NAN) {}
 Sensor::Sensor() : Sensor("") {}
 
+Sensor::RuntimeOverrides *Sensor::get_runtime_overrides_() {
+  if (this->runtime_overrides_ == nullptr)
+    this->runtime_overrides_ = make_unique<RuntimeOverrides>();
+  return this->runtime_overrides_.get();
+}
+
 std::string Sensor::get_unit_of_measurement() {
-  if (this->unit_of_measurement_.has_value())
-    return *this->unit_of_measurement_;
+  if (this->unit_of_measurement_ != nullptr)
+    return this->unit_of_measurement_;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
   return this->unit_of_measurement();
 #pragma GCC diagnostic pop
 }
 void Sensor::set_unit_of_measurement(const std::string &unit_of_measurement) {
+  this->get_runtime_overrides_()->unit_of_measurement = unit_of_measurement;
+  this->unit_of_measurement_ = this->runtime_overrides_->unit_of_measurement.c_str();
+}
+void Sensor::set_unit_of_measurement(const char *unit_of_measurement) {
   this->unit_of_measurement_ = unit_of_measurement;
 }
 std::string Sensor::unit_of_measurement() { return ""; }
@@ -48,14 +58,18 @@ void Sensor::set_accuracy_decimals(int8_t accuracy_decimals) { this->accuracy_de
 int8_t Sensor::accuracy_decimals() { return 0; }
 
 std::string Sensor::get_device_class() {
-  if (this->device_class_.has_value())
-    return *this->device_class_;
+  if (this->device_class_ != nullptr)
+    return this->device_class_;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
   return this->device_class();
 #pragma GCC diagnostic pop
 }
-void Sensor::set_device_class(const std::string &device_class) { this->device_class_ = device_class; }
+void Sensor::set_device_class(const std::string &device_class) {
+  this->get_runtime_overrides_()->device_class = device_class;
+  this->device_class_ = this->runtime_overrides_->device_class.c_str();
+}
+void Sensor::set_device_class(const char *device_class) { this->device_class_ = device_class; }
 std::string Sensor::device_class() { return ""; }
 
 void Sensor::set_state_class(StateClass state_class) { this->state_class_ = state_class; }
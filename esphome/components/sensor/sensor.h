@@ -54,6 +54,9 @@ class Sensor : public EntityBase {
   std::string get_unit_of_measurement();
   /// Manually set the unit of measurement.
   void set_unit_of_measurement(const std::string &unit_of_measurement);
+  /// Manually set the unit of measurement without copying it. Only for the string literals from codegen, use the
+  /// std::string overload for anything else.
+  void set_unit_of_measurement(const char *unit_of_measurement);
 
   /// Get the accuracy in decimals, using the manual override if set.
   int8_t get_accuracy_decimals();
@@ -64,6 +67,9 @@ class Sensor : public EntityBase {
   std::string get_device_class();
   /// Manually set the device class.
   void set_device_class(const std::string &device_class);
+  /// Manually set the device class without copying it. Only for the string literals from codegen, use the
+  /// std::string overload for anything else.
+  void set_device_class(const char *device_class);
 
   /// Get the state class, using the manual override if set.
   StateClass get_state_class();
@@ -181,11 +187,19 @@ class Sensor : public EntityBase {
   bool has_state_{false};
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
-  optional<std::string> unit_of_measurement_;           ///< Unit of measurement override
+  /// Copies of the overrides set at runtime, the literals from codegen are referenced in place.
+  struct RuntimeOverrides {
+    std::string unit_of_measurement;
+    std::string device_class;
+  };
+  RuntimeOverrides *get_runtime_overrides_();
+
+  const char *unit_of_measurement_{nullptr};            ///< Unit of measurement override
   optional<int8_t> accuracy_decimals_;                  ///< Accuracy in decimals override
-  optional<std::string> device_class_;                  ///< Device class override
+  const char *device_class_{nullptr};                   ///< Device class override
   optional<StateClass> state_class_{STATE_CLASS_NONE};  ///< State class override
   bool force_update_{false};                            ///< Force update mode
+  std::unique_ptr<RuntimeOverrides> runtime_overrides_;
 };
 
 }  // namespace sensor
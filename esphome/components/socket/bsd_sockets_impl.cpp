@@ -4,7 +4,10 @@
 
 #ifdef USE_SOCKET_IMPL_BSD_SOCKETS
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
+#include <sys/select.h>
 
 #ifdef USE_ESP32
 #include <esp_idf_version.h>
@@ -33,9 +36,54 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
   return {};
 }
 
+// The monitored sockets, select()ed by wait_for_readiness()
+static fd_set monitored_fds;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+// The monitored sockets that were readable after the last wait_for_readiness()
+static fd_set ready_fds;            // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static int max_monitored_fd = -1;   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static size_t monitored_count = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static bool monitor_fd(int fd) {
+  if (fd < 0 || fd >= FD_SETSIZE)
+    return false;
+  FD_SET(fd, &monitored_fds);
+  // A new socket may have data before the next select(), so it starts out ready
+  FD_SET(fd, &ready_fds);
+  max_monitored_fd = std::max(max_monitored_fd, fd);
+  monitored_count++;
+  return true;
+}
+
+static void unmonitor_fd(int fd) {
+  FD_CLR(fd, &monitored_fds);
+  FD_CLR(fd, &ready_fds);
+  monitored_count--;
+  while (max_monitored_fd >= 0 && !FD_ISSET(max_monitored_fd, &monitored_fds))
+    max_monitored_fd--;
+}
+
+bool wait_for_readiness(uint32_t timeout_ms) {
+  if (monitored_count == 0)
+    return false;
+  ready_fds = monitored_fds;
+  struct timeval tv;
+  tv.tv_sec = timeout_ms / 1000;
+  tv.tv_usec = (timeout_ms % 1000) * 1000;
+  int ret = ::select(max_monitored_fd + 1, &ready_fds, nullptr, nullptr, &tv);
+  if (ret < 0) {
+    // Don't miss any data, and let the caller sleep instead
+    ready_fds = monitored_fds;
+    return false;
+  }
+  return true;
+}
+
 class BSDSocketImpl : public Socket {
  public:
-  BSDSocketImpl(int fd) : fd_(fd) {}
+  BSDSocketImpl(int fd, bool monitored = false) : fd_(fd) {
+    if (monitored)
+      monitored_ = monitor_fd(fd);
+  }
   ~BSDSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -45,14 +93,27 @@ class BSDSocketImpl : public Socket {
     int fd = ::accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
-    return make_unique<BSDSocketImpl>(fd);
+    return make_unique<BSDSocketImpl>(fd, monitored_);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
   int close() override {
+    if (monitored_) {
+      unmonitor_fd(fd_);
+      monitored_ = false;
+    }
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
   }
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override {
+    int ret = ::connect(fd_, addr, addrlen);
+    if (ret == -1 && errno == EISCONN)
+      return 0;
+    // Report a connection that is still being established the same way as the first call
+    if (ret == -1 && errno == EALREADY)
+      errno = EINPROGRESS;
+    return ret;
+  }
   int shutdown(int how) override { return ::shutdown(fd_, how); }
 
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override { return ::getpeername(fd_, addr, addrlen); }
@@ -144,10 +205,12 @@ class BSDSocketImpl : public Socket {
     ::fcntl(fd_, F_SETFL, fl);
     return 0;
   }
+  bool ready() const override { return !monitored_ || FD_ISSET(fd_, &ready_fds); }
 
  protected:
   int fd_;
   bool closed_ = false;
+  bool monitored_ = false;
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -157,6 +220,13 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{new BSDSocketImpl(ret)};
 }
 
+std::unique_ptr<Socket> socket_monitored(int domain, int type, int protocol) {
+  int ret = ::socket(domain, type, protocol);
+  if (ret == -1)
+    return nullptr;
+  return std::unique_ptr<Socket>{new BSDSocketImpl(ret, true)};
+}
+
 }  // namespace socket
 }  // namespace esphome
 
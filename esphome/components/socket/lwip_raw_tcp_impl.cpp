@@ -73,41 +73,14 @@ class LWIPRawImpl : public Socket {
     }
     ip_addr_t ip;
     in_port_t port;
+    if (this->sockaddr2ip_(name, addrlen, &ip, &port) != 0)
+      return -1;
 #if LWIP_IPV6
-    if (family_ == AF_INET) {
-      if (addrlen < sizeof(sockaddr_in)) {
-        errno = EINVAL;
-        return -1;
-      }
-      auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
-      port = ntohs(addr4->sin_port);
-      ip.type = IPADDR_TYPE_V4;
-      ip.u_addr.ip4.addr = addr4->sin_addr.s_addr;
-      LWIP_LOG("tcp_bind(%p ip=%s port=%u)", pcb_, ip4addr_ntoa(&ip.u_addr.ip4), port);
-    } else if (family_ == AF_INET6) {
-      if (addrlen < sizeof(sockaddr_in6)) {
-        errno = EINVAL;
-        return -1;
-      }
-      auto *addr6 = reinterpret_cast<const sockaddr_in6 *>(name);
-      port = ntohs(addr6->sin6_port);
+    // AF_INET6 sockets accept IPv4 connections as well
+    if (family_ == AF_INET6)
       ip.type = IPADDR_TYPE_ANY;
-      memcpy(&ip.u_addr.ip6.addr, &addr6->sin6_addr.un.u8_addr, 16);
-      LWIP_LOG("tcp_bind(%p ip=%s port=%u)", pcb_, ip6addr_ntoa(&ip.u_addr.ip6), port);
-    } else {
-      errno = EINVAL;
-      return -1;
-    }
-#else
-    if (family_ != AF_INET) {
-      errno = EINVAL;
-      return -1;
-    }
-    auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
-    port = ntohs(addr4->sin_port);
-    ip.addr = addr4->sin_addr.s_addr;
-    LWIP_LOG("tcp_bind(%p ip=%u port=%u)", pcb_, ip.addr, port);
 #endif
+    LWIP_LOG("tcp_bind(%p ip=%s port=%u)", pcb_, ipaddr_ntoa(&ip), port);
     err_t err = tcp_bind(pcb_, &ip, port);
     if (err == ERR_USE) {
       LWIP_LOG("  -> err ERR_USE");
@@ -126,6 +99,37 @@ class LWIPRawImpl : public Socket {
     }
     return 0;
   }
+  int connect(const struct sockaddr *name, socklen_t addrlen) override {
+    if (connected_)
+      return 0;
+    if (pcb_ == nullptr) {
+      // err_fn() frees the pcb when the connection attempt fails
+      errno = connecting_ ? ECONNREFUSED : EBADF;
+      return -1;
+    }
+    if (connecting_) {
+      errno = EINPROGRESS;
+      return -1;
+    }
+    if (name == nullptr) {
+      errno = EINVAL;
+      return -1;
+    }
+    ip_addr_t ip;
+    in_port_t port;
+    if (this->sockaddr2ip_(name, addrlen, &ip, &port) != 0)
+      return -1;
+    LWIP_LOG("tcp_connect(%p ip=%s port=%u)", pcb_, ipaddr_ntoa(&ip), port);
+    err_t err = tcp_connect(pcb_, &ip, port, LWIPRawImpl::s_connected_fn);
+    if (err != ERR_OK) {
+      LWIP_LOG("  -> err %d", err);
+      errno = err == ERR_MEM ? ENOMEM : EIO;
+      return -1;
+    }
+    connecting_ = true;
+    errno = EINPROGRESS;
+    return -1;
+  }
   int close() override {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
@@ -307,6 +311,28 @@ class LWIPRawImpl : public Socket {
     return 0;
   }
   ssize_t read(void *buf, size_t len) override {
+    if (len == 0 && pcb_ != nullptr)
+      return 0;
+
+    size_t read = 0;
+    uint8_t *buf8 = reinterpret_cast<uint8_t *>(buf);
+    while (read < len) {
+      uint8_t *data;
+      ssize_t available = this->peek(&data);
+      if (available <= 0) {
+        if (read != 0)
+          // return what we have, the error is reported on the next call
+          break;
+        return available;
+      }
+      size_t copysize = std::min(len - read, (size_t) available);
+      memcpy(buf8 + read, data, copysize);
+      this->consume(copysize);
+      read += copysize;
+    }
+    return read;
+  }
+  ssize_t peek(uint8_t **data) override {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
       return -1;
@@ -314,55 +340,38 @@ class LWIPRawImpl : public Socket {
     if (rx_closed_ && rx_buf_ == nullptr) {
       return 0;
     }
-    if (len == 0) {
-      return 0;
-    }
+    // skip exhausted buffers, an empty chunk would look like a closed connection
+    while (rx_buf_ != nullptr && rx_buf_offset_ == rx_buf_->len)
+      this->free_rx_head_();
     if (rx_buf_ == nullptr) {
       errno = EWOULDBLOCK;
       return -1;
     }
-
-    size_t read = 0;
-    uint8_t *buf8 = reinterpret_cast<uint8_t *>(buf);
+    *data = reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_;
+    return rx_buf_->len - rx_buf_offset_;
+  }
+  int consume(size_t len) override {
+    if (pcb_ == nullptr) {
+      errno = ECONNRESET;
+      return -1;
+    }
+    size_t consumed = 0;
     while (len && rx_buf_ != nullptr) {
-      size_t pb_len = rx_buf_->len;
-      size_t pb_left = pb_len - rx_buf_offset_;
-      if (pb_left == 0)
-        break;
-      size_t copysize = std::min(len, pb_left);
-      memcpy(buf8, reinterpret_cast<uint8_t *>(rx_buf_->payload) + rx_buf_offset_, copysize);
-
-      if (pb_left == copysize) {
-        // full pb copied, free it
-        if (rx_buf_->next == nullptr) {
-          // last buffer in chain
-          pbuf_free(rx_buf_);
-          rx_buf_ = nullptr;
-          rx_buf_offset_ = 0;
-        } else {
-          auto *old_buf = rx_buf_;
-          rx_buf_ = rx_buf_->next;
-          pbuf_ref(rx_buf_);
-          pbuf_free(old_buf);
-          rx_buf_offset_ = 0;
-        }
+      size_t pb_left = rx_buf_->len - rx_buf_offset_;
+      size_t size = std::min(len, pb_left);
+      if (pb_left == size) {
+        this->free_rx_head_();
       } else {
-        rx_buf_offset_ += copysize;
+        rx_buf_offset_ += size;
       }
-      LWIP_LOG("tcp_recved(%p %u)", pcb_, copysize);
-      tcp_recved(pcb_, copysize);
-
-      buf8 += copysize;
-      len -= copysize;
-      read += copysize;
+      len -= size;
+      consumed += size;
     }
-
-    if (read == 0) {
-      errno = EWOULDBLOCK;
-      return -1;
+    if (consumed != 0) {
+      LWIP_LOG("tcp_recved(%p %u)", pcb_, consumed);
+      tcp_recved(pcb_, consumed);
     }
-
-    return read;
+    return 0;
   }
   ssize_t readv(const struct iovec *iov, int iovcnt) override {
     ssize_t ret = 0;
@@ -480,6 +489,11 @@ class LWIPRawImpl : public Socket {
     return 0;
   }
 
+  // The receive and accept callbacks keep these up to date, so readiness is always known
+  bool ready() const override {
+    return rx_buf_ != nullptr || rx_closed_ || !accepted_sockets_.empty() || pcb_ == nullptr;
+  }
+
   err_t accept_fn(struct tcp_pcb *newpcb, err_t err) {
     LWIP_LOG("accept(newpcb=%p err=%d)", newpcb, err);
     if (err != ERR_OK || newpcb == nullptr) {
@@ -494,6 +508,11 @@ class LWIPRawImpl : public Socket {
     accepted_sockets_.push(std::move(sock));
     return ERR_OK;
   }
+  err_t connected_fn(err_t err) {
+    LWIP_LOG("connected(err=%d)", err);
+    connected_ = true;
+    return ERR_OK;
+  }
   void err_fn(err_t err) {
     LWIP_LOG("err(err=%d)", err);
     // "If a connection is aborted because of an error, the application is alerted of this event by
@@ -530,6 +549,11 @@ class LWIPRawImpl : public Socket {
     return arg_this->accept_fn(newpcb, err);
   }
 
+  static err_t s_connected_fn(void *arg, struct tcp_pcb *pcb, err_t err) {
+    LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
+    return arg_this->connected_fn(err);
+  }
+
   static void s_err_fn(void *arg, err_t err) {
     LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
     arg_this->err_fn(err);
@@ -541,6 +565,56 @@ class LWIPRawImpl : public Socket {
   }
 
  protected:
+  // Free the first pbuf of the receive chain
+  void free_rx_head_() {
+    if (rx_buf_->next == nullptr) {
+      // last buffer in chain
+      pbuf_free(rx_buf_);
+      rx_buf_ = nullptr;
+    } else {
+      auto *old_buf = rx_buf_;
+      rx_buf_ = rx_buf_->next;
+      pbuf_ref(rx_buf_);
+      pbuf_free(old_buf);
+    }
+    rx_buf_offset_ = 0;
+  }
+  int sockaddr2ip_(const struct sockaddr *name, socklen_t addrlen, ip_addr_t *ip, in_port_t *port) {
+#if LWIP_IPV6
+    if (family_ == AF_INET) {
+      if (addrlen < sizeof(sockaddr_in)) {
+        errno = EINVAL;
+        return -1;
+      }
+      auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
+      *port = ntohs(addr4->sin_port);
+      ip->type = IPADDR_TYPE_V4;
+      ip->u_addr.ip4.addr = addr4->sin_addr.s_addr;
+      return 0;
+    } else if (family_ == AF_INET6) {
+      if (addrlen < sizeof(sockaddr_in6)) {
+        errno = EINVAL;
+        return -1;
+      }
+      auto *addr6 = reinterpret_cast<const sockaddr_in6 *>(name);
+      *port = ntohs(addr6->sin6_port);
+      ip->type = IPADDR_TYPE_V6;
+      memcpy(&ip->u_addr.ip6.addr, &addr6->sin6_addr.un.u8_addr, 16);
+      return 0;
+    }
+    errno = EINVAL;
+    return -1;
+#else
+    if (family_ != AF_INET || addrlen < sizeof(sockaddr_in)) {
+      errno = EINVAL;
+      return -1;
+    }
+    auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
+    *port = ntohs(addr4->sin_port);
+    ip->addr = addr4->sin_addr.s_addr;
+    return 0;
+#endif
+  }
   int ip2sockaddr_(ip_addr_t *ip, uint16_t port, struct sockaddr *name, socklen_t *addrlen) {
     if (family_ == AF_INET) {
       if (*addrlen < sizeof(struct sockaddr_in)) {
@@ -584,6 +658,8 @@ class LWIPRawImpl : public Socket {
   struct tcp_pcb *pcb_;
   std::queue<std::unique_ptr<LWIPRawImpl>> accepted_sockets_;
   bool rx_closed_ = false;
+  bool connecting_ = false;
+  bool connected_ = false;
   pbuf *rx_buf_ = nullptr;
   size_t rx_buf_offset_ = 0;
   // don't use lwip nodelay flag, it sometimes causes reconnect
@@ -601,6 +677,9 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{sock};
 }
 
+// Raw TCP sockets track their readiness in the lwIP callbacks, they don't need to be registered anywhere
+std::unique_ptr<Socket> socket_monitored(int domain, int type, int protocol) { return socket(domain, type, protocol); }
+
 }  // namespace socket
 }  // namespace esphome
 
@@ -6,6 +6,16 @@
 namespace esphome {
 namespace socket {
 
+ssize_t Socket::peek(uint8_t **data) {
+  errno = EOPNOTSUPP;
+  return -1;
+}
+
+int Socket::consume(size_t len) {
+  errno = EOPNOTSUPP;
+  return -1;
+}
+
 std::unique_ptr<Socket> socket_ip(int type, int protocol) {
 #if LWIP_IPV6
   return socket(AF_INET6, type, protocol);
@@ -14,6 +24,14 @@ std::unique_ptr<Socket> socket_ip(int type, int protocol) {
 #endif
 }
 
+std::unique_ptr<Socket> socket_ip_monitored(int type, int protocol) {
+#if LWIP_IPV6
+  return socket_monitored(AF_INET6, type, protocol);
+#else
+  return socket_monitored(AF_INET, type, protocol);
+#endif
+}
+
 socklen_t set_sockaddr_any(struct sockaddr *addr, socklen_t addrlen, uint16_t port) {
 #if LWIP_IPV6
   if (addrlen < sizeof(sockaddr_in6)) {
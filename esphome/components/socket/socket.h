@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "headers.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -18,9 +19,12 @@ class Socket {
   virtual std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual int bind(const struct sockaddr *addr, socklen_t addrlen) = 0;
   virtual int close() = 0;
-  // not supported yet:
-  // virtual int connect(const std::string &address) = 0;
-  // virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
+  /** Connect to \p addr, without blocking on non-blocking sockets.
+   *
+   * Returns -1 with errno EINPROGRESS while the connection is established, call it again with the same address
+   * until it returns 0 once connected, or fails with the reason the connection couldn't be established.
+   */
+  virtual int connect(const struct sockaddr *addr, socklen_t addrlen) = 0;
   virtual int shutdown(int how) = 0;
 
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
@@ -32,10 +36,27 @@ class Socket {
   virtual int listen(int backlog) = 0;
   virtual ssize_t read(void *buf, size_t len) = 0;
   virtual ssize_t readv(const struct iovec *iov, int iovcnt) = 0;
+  /** Access the received data in place instead of copying it with read().
+   *
+   * Points \p data to the next contiguous chunk of received data and returns its length, which may be less than
+   * what has been received in total. The data stays valid until it is released with consume() or read().
+   * Otherwise behaves like read(): returns 0 if the peer closed the connection, or -1 and sets errno.
+   * Implementations that can't expose their receive buffer fail with errno EOPNOTSUPP, use read() then.
+   */
+  virtual ssize_t peek(uint8_t **data);
+  /// Release \p len bytes of the data returned by peek().
+  virtual int consume(size_t len);
   virtual ssize_t write(const void *buf, size_t len) = 0;
   virtual ssize_t writev(const struct iovec *iov, int iovcnt) = 0;
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /** Check whether read() or accept() may make progress, so idle sockets can be skipped without a syscall.
+   *
+   * Monitored sockets (see socket_monitored()) only report ready when data or a connection arrived or the peer
+   * closed the connection. Other sockets may always report ready.
+   */
+  virtual bool ready() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -44,6 +65,22 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
 std::unique_ptr<Socket> socket_ip(int type, int protocol);
 
+/// Create a socket whose readiness is monitored by the main loop, see Socket::ready(). Accepted sockets inherit it.
+std::unique_ptr<Socket> socket_monitored(int domain, int type, int protocol);
+
+/// Create a monitored socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
+std::unique_ptr<Socket> socket_ip_monitored(int type, int protocol);
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+/** Wait until a monitored socket becomes readable or \p timeout_ms passed, and update their ready() state.
+ *
+ * Called by the main loop instead of delay(), so it wakes up as soon as data arrives.
+ *
+ * @return false if it didn't wait because no socket is monitored or select() failed.
+ */
+bool wait_for_readiness(uint32_t timeout_ms);
+#endif
+
 /// Set a sockaddr to the any address for the IP version used by socket_ip().
 socklen_t set_sockaddr_any(struct sockaddr *addr, socklen_t addrlen, uint16_t port);
 
@@ -12,6 +12,7 @@
 #include "StreamString.h"
 
 #include <cstdlib>
+#include <cstring>
 
 #ifdef USE_LIGHT
 #include "esphome/components/light/light_json_schema.h"
@@ -34,6 +35,12 @@ namespace web_server {
 
 static const char *const TAG = "web_server";
 
+/// State updates of the same entity within this window are merged into one event.
+static const uint32_t EVENT_COALESCE_WINDOW = 100;
+/// Stop queueing state events once the clients have this many events waiting on average
+/// (AsyncEventSource drops events beyond SSE_MAX_QUEUED_MESSAGES = 32 per client).
+static const size_t EVENT_MAX_BACKLOG = 16;
+
 #if USE_WEBSERVER_VERSION == 1
 void write_row(AsyncResponseStream *stream, EntityBase *obj, const std::string &klass, const std::string &action,
                const std::function<void(AsyncResponseStream &stream, EntityBase *obj)> &action_func = nullptr) {
@@ -57,29 +64,27 @@ void write_row(AsyncResponseStream *stream, EntityBase *obj, const std::string &
 }
 #endif
 
-UrlMatch match_url(const std::string &url, bool only_domain = false) {
+UrlMatch match_url(const char *url, bool only_domain = false) {
   UrlMatch match;
   match.valid = false;
-  size_t domain_end = url.find('/', 1);
-  if (domain_end == std::string::npos)
+  const char *domain_end = url[0] != '\0' ? strchr(url + 1, '/') : nullptr;
+  if (domain_end == nullptr)
     return match;
-  match.domain = url.substr(1, domain_end - 1);
+  match.domain = StringRef(url + 1, domain_end - url - 1);
   if (only_domain) {
     match.valid = true;
     return match;
   }
-  if (url.length() == domain_end - 1)
-    return match;
-  size_t id_begin = domain_end + 1;
-  size_t id_end = url.find('/', id_begin);
+  const char *id_begin = domain_end + 1;
+  const char *id_end = strchr(id_begin, '/');
   match.valid = true;
-  if (id_end == std::string::npos) {
-    match.id = url.substr(id_begin, url.length() - id_begin);
-    return match;
+  if (id_end == nullptr) {
+    match.id = StringRef(id_begin);
+  } else {
+    match.id = StringRef(id_begin, id_end - id_begin);
+    match.method = StringRef(id_end + 1);
   }
-  match.id = url.substr(id_begin, id_end - id_begin);
-  size_t method_begin = id_end + 1;
-  match.method = url.substr(method_begin, url.length() - method_begin);
+  match.key = fnv1_hash(match.id.c_str(), match.id.size());
   return match;
 }
 
@@ -120,13 +125,60 @@ void WebServer::setup() {
 
   this->set_interval(10000, [this]() { this->events_.send("", "ping", millis(), 30000); });
 }
-void WebServer::loop() { this->entities_iterator_.advance(); }
+void WebServer::loop() {
+  // The initial state of all entities is streamed one entity per loop, as fast as the clients take it
+  if (!this->clients_lagging_())
+    this->entities_iterator_.advance();
+  this->send_pending_events_();
+}
 void WebServer::dump_config() {
   ESP_LOGCONFIG(TAG, "Web Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->base_->get_port());
+  // Logged again whenever a log client connects, the counters show how well the state events are coalesced
+  ESP_LOGCONFIG(TAG, "  State Events: %u sent, %u merged, %u times deferred", this->events_sent_, this->events_merged_,
+                this->events_deferred_);
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
+bool WebServer::clients_lagging_() const { return this->events_.avgPacketsWaiting() >= EVENT_MAX_BACKLOG; }
+void WebServer::schedule_event_(void *source, message_generator_t *message_generator) {
+  // Without clients there's nobody to send the update to, new clients get the current state on connect
+  if (this->events_.count() == 0)
+    return;
+  for (auto &event : this->pending_events_) {
+    if (event.source == source) {
+      // The state is read when the event is sent, so the pending event already covers this update
+      this->events_merged_++;
+      return;
+    }
+  }
+  if (this->pending_events_.empty())
+    this->pending_since_ = millis();
+  this->pending_events_.push_back(PendingEvent{source, message_generator});
+}
+void WebServer::send_pending_events_() {
+  if (this->pending_events_.empty() || millis() - this->pending_since_ < EVENT_COALESCE_WINDOW)
+    return;
+  if (this->events_.count() == 0) {
+    this->pending_events_.clear();
+    return;
+  }
+
+  size_t sent = 0;
+  for (auto &event : this->pending_events_) {
+    if (this->clients_lagging_()) {
+      // Keep the remaining events pending, later updates of these entities are merged into them
+      this->events_deferred_++;
+      ESP_LOGV(TAG, "Clients lagging behind, deferring %zu state events", this->pending_events_.size() - sent);
+      break;
+    }
+    this->events_.send(event.message_generator(this, event.source).c_str(), "state");
+    sent++;
+  }
+  this->events_sent_ += sent;
+  this->pending_events_.erase(this->pending_events_.begin(), this->pending_events_.begin() + sent);
+}
+
 #ifdef USE_WEBSERVER_LOCAL
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
   AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
@@ -346,17 +398,19 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<sensor::Sensor *>(source);
+    return web_server->sensor_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  auto *obj = App.get_sensor_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", data.c_str());
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
   return json::build_json([obj, value, start_config](JsonObject root) {
@@ -375,17 +429,19 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<text_sensor::TextSensor *>(source);
+    return web_server->text_sensor_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  auto *obj = App.get_text_sensor_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", data.c_str());
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
@@ -397,88 +453,98 @@ std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std:
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<switch_::Switch *>(source);
+    return web_server->switch_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
   return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value,
+                              start_config);
   });
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->defer([obj]() { obj->toggle(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      this->defer([obj]() { obj->turn_on(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->defer([obj]() { obj->turn_off(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  auto *obj = App.get_switch_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET) {
+    std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->defer([obj]() { obj->toggle(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    this->defer([obj]() { obj->turn_on(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->defer([obj]() { obj->turn_off(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_BUTTON
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json(
-      [obj, start_config](JsonObject root) { set_json_id(root, obj, "button-" + obj->get_object_id(), start_config); });
+  return json::build_json([obj, start_config](JsonObject root) {
+    set_json_id(root, obj, "button-" + obj->get_object_id(), start_config);
+  });
 }
 
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_POST && match.method == "press") {
-      this->defer([obj]() { obj->press(); });
-      request->send(200);
-      return;
-    } else {
-      request->send(404);
-    }
+  auto *obj = App.get_button_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_POST && match.method == "press") {
+    this->defer([obj]() { obj->press(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<binary_sensor::BinarySensor *>(source);
+    return web_server->binary_sensor_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
   return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+    set_json_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
+                         start_config);
   });
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  auto *obj = App.get_binary_sensor_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", data.c_str());
 }
 #endif
 
 #ifdef USE_FAN
-void WebServer::on_fan_update(fan::Fan *obj) { this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state"); }
+void WebServer::on_fan_update(fan::Fan *obj) {
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<fan::Fan *>(source);
+    return web_server->fan_json(entity, DETAIL_STATE);
+  });
+}
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
   return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state, start_config);
+    set_json_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
+                         start_config);
     const auto traits = obj->get_traits();
     if (traits.supports_speed()) {
       root["speed_level"] = obj->speed;
@@ -489,123 +555,122 @@ std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
   });
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->fan_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->defer([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("speed")) {
-        String speed = request->getParam("speed")->value();
+  auto *obj = App.get_fan_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->fan_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->defer([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("speed")) {
+      String speed = request->getParam("speed")->value();
+    }
+    if (request->hasParam("speed_level")) {
+      String speed_level = request->getParam("speed_level")->value();
+      auto val = parse_number<int>(speed_level.c_str());
+      if (!val.has_value()) {
+        ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+        return;
       }
-      if (request->hasParam("speed_level")) {
-        String speed_level = request->getParam("speed_level")->value();
-        auto val = parse_number<int>(speed_level.c_str());
-        if (!val.has_value()) {
-          ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+      call.set_speed(*val);
+    }
+    if (request->hasParam("oscillation")) {
+      String speed = request->getParam("oscillation")->value();
+      auto val = parse_on_off(speed.c_str());
+      switch (val) {
+        case PARSE_ON:
+          call.set_oscillating(true);
+          break;
+        case PARSE_OFF:
+          call.set_oscillating(false);
+          break;
+        case PARSE_TOGGLE:
+          call.set_oscillating(!obj->oscillating);
+          break;
+        case PARSE_NONE:
+          request->send(404);
           return;
-        }
-        call.set_speed(*val);
       }
-      if (request->hasParam("oscillation")) {
-        String speed = request->getParam("oscillation")->value();
-        auto val = parse_on_off(speed.c_str());
-        switch (val) {
-          case PARSE_ON:
-            call.set_oscillating(true);
-            break;
-          case PARSE_OFF:
-            call.set_oscillating(false);
-            break;
-          case PARSE_TOGGLE:
-            call.set_oscillating(!obj->oscillating);
-            break;
-          case PARSE_NONE:
-            request->send(404);
-            return;
-        }
-      }
-      this->defer([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->defer([obj]() { obj->turn_off().perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->defer([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->defer([obj]() { obj->turn_off().perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 #endif
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<light::LightState *>(source);
+    return web_server->light_json(entity, DETAIL_STATE);
+  });
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->light_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->defer([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("brightness"))
-        call.set_brightness(request->getParam("brightness")->value().toFloat() / 255.0f);
-      if (request->hasParam("r"))
-        call.set_red(request->getParam("r")->value().toFloat() / 255.0f);
-      if (request->hasParam("g"))
-        call.set_green(request->getParam("g")->value().toFloat() / 255.0f);
-      if (request->hasParam("b"))
-        call.set_blue(request->getParam("b")->value().toFloat() / 255.0f);
-      if (request->hasParam("white_value"))
-        call.set_white(request->getParam("white_value")->value().toFloat() / 255.0f);
-      if (request->hasParam("color_temp"))
-        call.set_color_temperature(request->getParam("color_temp")->value().toFloat());
-
-      if (request->hasParam("flash")) {
-        float length_s = request->getParam("flash")->value().toFloat();
-        call.set_flash_length(static_cast<uint32_t>(length_s * 1000));
-      }
+  auto *obj = App.get_light_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->light_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->defer([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("brightness"))
+      call.set_brightness(request->getParam("brightness")->value().toFloat() / 255.0f);
+    if (request->hasParam("r"))
+      call.set_red(request->getParam("r")->value().toFloat() / 255.0f);
+    if (request->hasParam("g"))
+      call.set_green(request->getParam("g")->value().toFloat() / 255.0f);
+    if (request->hasParam("b"))
+      call.set_blue(request->getParam("b")->value().toFloat() / 255.0f);
+    if (request->hasParam("white_value"))
+      call.set_white(request->getParam("white_value")->value().toFloat() / 255.0f);
+    if (request->hasParam("color_temp"))
+      call.set_color_temperature(request->getParam("color_temp")->value().toFloat());
+
+    if (request->hasParam("flash")) {
+      float length_s = request->getParam("flash")->value().toFloat();
+      call.set_flash_length(static_cast<uint32_t>(length_s * 1000));
+    }
 
-      if (request->hasParam("transition")) {
-        float length_s = request->getParam("transition")->value().toFloat();
-        call.set_transition_length(static_cast<uint32_t>(length_s * 1000));
-      }
+    if (request->hasParam("transition")) {
+      float length_s = request->getParam("transition")->value().toFloat();
+      call.set_transition_length(static_cast<uint32_t>(length_s * 1000));
+    }
 
-      if (request->hasParam("effect")) {
-        const char *effect = request->getParam("effect")->value().c_str();
-        call.set_effect(effect);
-      }
+    if (request->hasParam("effect")) {
+      const char *effect = request->getParam("effect")->value().c_str();
+      call.set_effect(effect);
+    }
 
-      this->defer([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      auto call = obj->turn_off();
-      if (request->hasParam("transition")) {
-        auto length = (uint32_t) request->getParam("transition")->value().toFloat() * 1000;
-        call.set_transition_length(length);
-      }
-      this->defer([call]() mutable { call.perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
+    this->defer([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    auto call = obj->turn_off();
+    if (request->hasParam("transition")) {
+      auto length = (uint32_t) request->getParam("transition")->value().toFloat() * 1000;
+      call.set_transition_length(length);
     }
-    return;
+    this->defer([call]() mutable { call.perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
   return json::build_json([obj, start_config](JsonObject root) {
@@ -626,48 +691,49 @@ std::string WebServer::light_json(light::LightState *obj, JsonDetail start_confi
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
-  this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<cover::Cover *>(source);
+    return web_server->cover_json(entity, DETAIL_STATE);
+  });
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->cover_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      continue;
-    }
-
-    auto call = obj->make_call();
-    if (match.method == "open") {
-      call.set_command_open();
-    } else if (match.method == "close") {
-      call.set_command_close();
-    } else if (match.method == "stop") {
-      call.set_command_stop();
-    } else if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto traits = obj->get_traits();
-    if ((request->hasParam("position") && !traits.get_supports_position()) ||
-        (request->hasParam("tilt") && !traits.get_supports_tilt())) {
-      request->send(409);
-      return;
-    }
+  auto *obj = App.get_cover_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->cover_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    if (request->hasParam("position"))
-      call.set_position(request->getParam("position")->value().toFloat());
-    if (request->hasParam("tilt"))
-      call.set_tilt(request->getParam("tilt")->value().toFloat());
+  auto call = obj->make_call();
+  if (match.method == "open") {
+    call.set_command_open();
+  } else if (match.method == "close") {
+    call.set_command_close();
+  } else if (match.method == "stop") {
+    call.set_command_stop();
+  } else if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
+  auto traits = obj->get_traits();
+  if ((request->hasParam("position") && !traits.get_supports_position()) ||
+      (request->hasParam("tilt") && !traits.get_supports_tilt())) {
+    request->send(409);
     return;
   }
-  request->send(404);
+
+  if (request->hasParam("position"))
+    call.set_position(request->getParam("position")->value().toFloat());
+  if (request->hasParam("tilt"))
+    call.set_tilt(request->getParam("tilt")->value().toFloat());
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
   return json::build_json([obj, start_config](JsonObject root) {
@@ -683,36 +749,37 @@ std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<number::Number *>(source);
+    return web_server->number_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("value")) {
-      String value = request->getParam("value")->value();
-      optional<float> value_f = parse_number<float>(value.c_str());
-      if (value_f.has_value())
-        call.set_value(*value_f);
-    }
-
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
+  auto *obj = App.get_number_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET) {
+    std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
+
+  auto call = obj->make_call();
+  if (request->hasParam("value")) {
+    String value = request->getParam("value")->value();
+    optional<float> value_f = parse_number<float>(value.c_str());
+    if (value_f.has_value())
+      call.set_value(*value_f);
+  }
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
@@ -740,36 +807,37 @@ std::string WebServer::number_json(number::Number *obj, float value, JsonDetail
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<select::Select *>(source);
+    return web_server->select_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->select_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto *obj = App.get_select_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->select_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("option")) {
-      String option = request->getParam("option")->value();
-      call.set_option(option.c_str());  // NOLINT(clang-diagnostic-deprecated-declarations)
-    }
+  auto call = obj->make_call();
 
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("option")) {
+    String option = request->getParam("option")->value();
+    call.set_option(option.c_str());  // NOLINT(clang-diagnostic-deprecated-declarations)
   }
-  request->send(404);
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
   return json::build_json([obj, value, start_config](JsonObject root) {
@@ -786,58 +854,59 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
-  this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<climate::Climate *>(source);
+    return web_server->climate_json(entity, DETAIL_STATE);
+  });
 }
 
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->climate_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto *obj = App.get_climate_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data = this->climate_json(obj, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("mode")) {
-      String mode = request->getParam("mode")->value();
-      call.set_mode(mode.c_str());
-    }
+  auto call = obj->make_call();
 
-    if (request->hasParam("target_temperature_high")) {
-      String value = request->getParam("target_temperature_high")->value();
-      optional<float> value_f = parse_number<float>(value.c_str());
-      if (value_f.has_value())
-        call.set_target_temperature_high(*value_f);
-    }
+  if (request->hasParam("mode")) {
+    String mode = request->getParam("mode")->value();
+    call.set_mode(mode.c_str());
+  }
 
-    if (request->hasParam("target_temperature_low")) {
-      String value = request->getParam("target_temperature_low")->value();
-      optional<float> value_f = parse_number<float>(value.c_str());
-      if (value_f.has_value())
-        call.set_target_temperature_low(*value_f);
-    }
+  if (request->hasParam("target_temperature_high")) {
+    String value = request->getParam("target_temperature_high")->value();
+    optional<float> value_f = parse_number<float>(value.c_str());
+    if (value_f.has_value())
+      call.set_target_temperature_high(*value_f);
+  }
 
-    if (request->hasParam("target_temperature")) {
-      String value = request->getParam("target_temperature")->value();
-      optional<float> value_f = parse_number<float>(value.c_str());
-      if (value_f.has_value())
-        call.set_target_temperature(*value_f);
-    }
+  if (request->hasParam("target_temperature_low")) {
+    String value = request->getParam("target_temperature_low")->value();
+    optional<float> value_f = parse_number<float>(value.c_str());
+    if (value_f.has_value())
+      call.set_target_temperature_low(*value_f);
+  }
 
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("target_temperature")) {
+    String value = request->getParam("target_temperature")->value();
+    optional<float> value_f = parse_number<float>(value.c_str());
+    if (value_f.has_value())
+      call.set_target_temperature(*value_f);
   }
-  request->send(404);
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 // Longest: HORIZONTAL
@@ -932,7 +1001,10 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
-  this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
+  this->schedule_event_(obj, [](WebServer *web_server, void *source) {
+    auto *entity = static_cast<lock::Lock *>(source);
+    return web_server->lock_json(entity, entity->state, DETAIL_STATE);
+  });
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
   return json::build_json([obj, value, start_config](JsonObject root) {
@@ -941,28 +1013,26 @@ std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDet
   });
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "lock") {
-      this->defer([obj]() { obj->lock(); });
-      request->send(200);
-    } else if (match.method == "unlock") {
-      this->defer([obj]() { obj->unlock(); });
-      request->send(200);
-    } else if (match.method == "open") {
-      this->defer([obj]() { obj->open(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  auto *obj = App.get_lock_by_key(match.key, true);
+  if (obj == nullptr || obj->get_object_id() != match.id) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET) {
+    std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "lock") {
+    this->defer([obj]() { obj->lock(); });
+    request->send(200);
+  } else if (match.method == "unlock") {
+    this->defer([obj]() { obj->unlock(); });
+    request->send(200);
+  } else if (match.method == "open") {
+    this->defer([obj]() { obj->open(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
@@ -7,22 +7,29 @@
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
+#include "esphome/core/string_ref.h"
 
 #include <vector>
 
 namespace esphome {
 namespace web_server {
 
-/// Internal helper struct that is used to parse incoming URLs
+/// Internal helper struct that is used to parse incoming URLs, references the URL of the request
 struct UrlMatch {
-  std::string domain;  ///< The domain of the component, for example "sensor"
-  std::string id;      ///< The id of the device that's being accessed, for example "living_room_fan"
-  std::string method;  ///< The method that's being called, for example "turn_on"
-  bool valid;          ///< Whether this match is valid
+  StringRef domain;  ///< The domain of the component, for example "sensor"
+  StringRef id;      ///< The id of the device that's being accessed, for example "living_room_fan"
+  StringRef method;  ///< The method that's being called, for example "turn_on"
+  uint32_t key;      ///< The hash of id, used to look up the entity by key
+  bool valid;        ///< Whether this match is valid
 };
 
 enum JsonDetail { DETAIL_ALL, DETAIL_STATE };
 
+class WebServer;
+
+/// Builds the state event of an entity from its current state.
+using message_generator_t = std::string(WebServer *web_server, void *source);
+
 /** This class allows users to create a web server with their ESP nodes.
  *
  * Behind the scenes it's using AsyncWebServer to set up the server. It exposes 3 things:
@@ -74,6 +81,13 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    */
   void set_allow_ota(bool allow_ota) { this->allow_ota_ = allow_ota; }
 
+  /// The number of state events that were sent to the event source.
+  uint32_t get_events_sent() const { return this->events_sent_; }
+  /// The number of state updates that replaced a still pending update of the same entity.
+  uint32_t get_events_merged() const { return this->events_merged_; }
+  /// The number of times sending pending state events was postponed because the clients were lagging behind.
+  uint32_t get_events_deferred() const { return this->events_deferred_; }
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Setup the internal web server and register handlers.
@@ -221,6 +235,19 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   friend ListEntitiesIterator;
+
+  struct PendingEvent {
+    void *source;
+    message_generator_t *message_generator;
+  };
+
+  /// Queue the state event of source, replacing an update of the same entity that hasn't been sent yet.
+  void schedule_event_(void *source, message_generator_t *message_generator);
+  /// Send the pending state events once the coalescing window has passed and the clients can keep up.
+  void send_pending_events_();
+  /// Whether the event queues of the connected clients are too full to queue more events.
+  bool clients_lagging_() const;
+
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
   ListEntitiesIterator entities_iterator_;
@@ -230,6 +257,11 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   const char *js_include_{nullptr};
   bool include_internal_{false};
   bool allow_ota_{true};
+  std::vector<PendingEvent> pending_events_;
+  uint32_t pending_since_{0};
+  uint32_t events_sent_{0};
+  uint32_t events_merged_{0};
+  uint32_t events_deferred_{0};
 };
 
 }  // namespace web_server
@@ -1,14 +1,19 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import esp32_ble_tracker
-from esphome.const import CONF_ID
+from esphome.components.esp32 import add_idf_sdkconfig_option
+from esphome.const import CONF_BINDKEY, CONF_ID, CONF_MAC_ADDRESS
+from esphome.core import CORE
 
 DEPENDENCIES = ["esp32_ble_tracker"]
 
+CONF_XIAOMI_BLE_ID = "xiaomi_ble_id"
+
 xiaomi_ble_ns = cg.esphome_ns.namespace("xiaomi_ble")
 XiaomiListener = xiaomi_ble_ns.class_(
     "XiaomiListener", esp32_ble_tracker.ESPBTDeviceListener
 )
+XiaomiDevice = xiaomi_ble_ns.class_("XiaomiDevice")
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -16,7 +21,27 @@ CONFIG_SCHEMA = cv.Schema(
     }
 ).extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
 
+XIAOMI_BLE_DEVICE_SCHEMA = esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA.extend(
+    {
+        cv.GenerateID(CONF_XIAOMI_BLE_ID): cv.use_id(XiaomiListener),
+    }
+)
+
+
+async def register_xiaomi_device(var, config):
+    paren = await cg.get_variable(config[CONF_XIAOMI_BLE_ID])
+    # The listener looks devices up by their address, so it has to be set first
+    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
+    if CONF_BINDKEY in config:
+        cg.add(var.set_bindkey(config[CONF_BINDKEY]))
+    cg.add(paren.register_device(var))
+    return var
+
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await esp32_ble_tracker.register_ble_device(var, config)
+
+    if CORE.using_esp_idf:
+        # Bindkey decryption runs AES-CCM through mbedtls, on the AES peripheral with this
+        add_idf_sdkconfig_option("CONFIG_MBEDTLS_HARDWARE_AES", True)
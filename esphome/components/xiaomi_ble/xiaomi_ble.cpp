@@ -88,6 +88,10 @@ bool parse_xiaomi_value(uint16_t value_type, const uint8_t *data, uint8_t value_
 }
 
 bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult &result) {
+  return parse_xiaomi_message(message.data(), message.size(), result);
+}
+
+bool parse_xiaomi_message(const uint8_t *message, uint8_t length, XiaomiParseResult &result) {
   result.has_encryption = message[0] & 0x08;  // update encryption status
   if (result.has_encryption) {
     ESP_LOGVV(TAG, "parse_xiaomi_message(): payload is encrypted, stop reading message.");
@@ -100,8 +104,8 @@ bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult
   // Byte 2: length
   // Byte 3..3+len-1: data point value
 
-  const uint8_t *payload = message.data() + result.raw_offset;
-  uint8_t payload_length = message.size() - result.raw_offset;
+  const uint8_t *payload = message + result.raw_offset;
+  uint8_t payload_length = length > result.raw_offset ? length - result.raw_offset : 0;
   uint8_t payload_offset = 0;
   bool success = false;
 
@@ -136,13 +140,22 @@ bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult
 }
 
 optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data) {
-  XiaomiParseResult result;
   if (!service_data.uuid.contains(0x95, 0xFE)) {
     ESP_LOGVV(TAG, "parse_xiaomi_header(): no service data UUID magic bytes.");
     return {};
   }
 
-  auto raw = service_data.data;
+  static int16_t last_frame_count = -1;
+  return parse_xiaomi_header(service_data.data.data(), service_data.data.size(), last_frame_count);
+}
+
+optional<XiaomiParseResult> parse_xiaomi_header(const uint8_t *raw, uint8_t length, int16_t &last_frame_count) {
+  XiaomiParseResult result;
+  if (length < 5) {
+    ESP_LOGVV(TAG, "parse_xiaomi_header(): service data too short (%d).", length);
+    return {};
+  }
+
   result.has_data = raw[0] & 0x40;
   result.has_capability = raw[0] & 0x20;
   result.has_encryption = raw[0] & 0x08;
@@ -152,7 +165,6 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
     return {};
   }
 
-  static uint8_t last_frame_count = 0;
   if (last_frame_count == raw[4]) {
     ESP_LOGVV(TAG, "parse_xiaomi_header(): duplicate data packet received (%d).", static_cast<int>(last_frame_count));
     result.is_duplicate = true;
@@ -205,7 +217,7 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
   } else if (device_uuid == 0x07f6) {  // Xiaomi-Yeelight BLE nightlight
     result.type = XiaomiParseResult::TYPE_MJYD02YLA;
     result.name = "MJYD02YLA";
-    if (raw.size() == 19)
+    if (length == 19)
       result.raw_offset -= 6;
   } else if (device_uuid == 0x06d3) {  // rectangular body, e-ink display with alarm
     result.type = XiaomiParseResult::TYPE_MHOC303;
@@ -216,12 +228,12 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
   } else if (device_uuid == 0x0A83) {  // Qingping-branded, motion & ambient light sensor
     result.type = XiaomiParseResult::TYPE_CGPR1;
     result.name = "CGPR1";
-    if (raw.size() == 19)
+    if (length == 19)
       result.raw_offset -= 6;
   } else if (device_uuid == 0x0A8D) {  // Xiaomi Mi Motion Sensor 2
     result.type = XiaomiParseResult::TYPE_RTCGQ02LM;
     result.name = "RTCGQ02LM";
-    if (raw.size() == 19)
+    if (length == 19)
       result.raw_offset -= 6;
   } else {
     ESP_LOGVV(TAG, "parse_xiaomi_header(): unknown device, no magic bytes.");
@@ -232,9 +244,25 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
 }
 
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address) {
-  if (!((raw.size() == 19) || ((raw.size() >= 22) && (raw.size() <= 24)))) {
-    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", raw.size());
-    ESP_LOGVV(TAG, "  Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
+  mbedtls_ccm_context ctx;
+  mbedtls_ccm_init(&ctx);
+
+  int ret = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, bindkey, 16 * 8);
+  if (ret) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): mbedtls_ccm_setkey() failed.");
+    mbedtls_ccm_free(&ctx);
+    return false;
+  }
+
+  bool success = decrypt_xiaomi_payload(raw.data(), raw.size(), &ctx, address);
+  mbedtls_ccm_free(&ctx);
+  return success;
+}
+
+bool decrypt_xiaomi_payload(uint8_t *raw, uint8_t length, mbedtls_ccm_context *ctx, const uint64_t &address) {
+  if (!((length == 19) || ((length >= 22) && (length <= 24)))) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", length);
+    ESP_LOGVV(TAG, "  Packet : %s", format_hex_pretty(raw, length).c_str());
     return false;
   }
 
@@ -258,29 +286,18 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
                          .tagsize = 4,
                          .ivsize = 12};
 
-  vector.datasize = (raw.size() == 19) ? raw.size() - 12 : raw.size() - 18;
-  int cipher_pos = (raw.size() == 19) ? 5 : 11;
+  vector.datasize = (length == 19) ? length - 12 : length - 18;
+  int cipher_pos = (length == 19) ? 5 : 11;
 
-  const uint8_t *v = raw.data();
+  const uint8_t *v = raw;
 
-  memcpy(vector.key, bindkey, vector.keysize);
   memcpy(vector.ciphertext, v + cipher_pos, vector.datasize);
-  memcpy(vector.tag, v + raw.size() - vector.tagsize, vector.tagsize);
-  memcpy(vector.iv, mac_reverse, 6);             // MAC address reverse
-  memcpy(vector.iv + 6, v + 2, 3);               // sensor type (2) + packet id (1)
-  memcpy(vector.iv + 9, v + raw.size() - 7, 3);  // payload counter
-
-  mbedtls_ccm_context ctx;
-  mbedtls_ccm_init(&ctx);
+  memcpy(vector.tag, v + length - vector.tagsize, vector.tagsize);
+  memcpy(vector.iv, mac_reverse, 6);          // MAC address reverse
+  memcpy(vector.iv + 6, v + 2, 3);            // sensor type (2) + packet id (1)
+  memcpy(vector.iv + 9, v + length - 7, 3);  // payload counter
 
-  int ret = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, vector.key, vector.keysize * 8);
-  if (ret) {
-    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): mbedtls_ccm_setkey() failed.");
-    mbedtls_ccm_free(&ctx);
-    return false;
-  }
-
-  ret = mbedtls_ccm_auth_decrypt(&ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
+  int ret = mbedtls_ccm_auth_decrypt(ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
                                  vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
   if (ret) {
     uint8_t mac_address[6] = {0};
@@ -292,30 +309,23 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
     memcpy(mac_address + 5, mac_reverse, 1);
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption failed.");
     ESP_LOGVV(TAG, "  MAC address : %s", format_hex_pretty(mac_address, 6).c_str());
-    ESP_LOGVV(TAG, "       Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
-    ESP_LOGVV(TAG, "          Key : %s", format_hex_pretty(vector.key, vector.keysize).c_str());
+    ESP_LOGVV(TAG, "       Packet : %s", format_hex_pretty(raw, length).c_str());
     ESP_LOGVV(TAG, "           Iv : %s", format_hex_pretty(vector.iv, vector.ivsize).c_str());
     ESP_LOGVV(TAG, "       Cipher : %s", format_hex_pretty(vector.ciphertext, vector.datasize).c_str());
     ESP_LOGVV(TAG, "          Tag : %s", format_hex_pretty(vector.tag, vector.tagsize).c_str());
-    mbedtls_ccm_free(&ctx);
     return false;
   }
 
   // replace encrypted payload with plaintext
-  uint8_t *p = vector.plaintext;
-  for (std::vector<uint8_t>::iterator it = raw.begin() + cipher_pos; it != raw.begin() + cipher_pos + vector.datasize;
-       ++it) {
-    *it = *(p++);
-  }
+  memcpy(raw + cipher_pos, vector.plaintext, vector.datasize);
 
   // clear encrypted flag
   raw[0] &= ~0x08;
 
   ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption passed.");
-  ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(raw.data() + cipher_pos, vector.datasize).c_str(),
+  ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(raw + cipher_pos, vector.datasize).c_str(),
             static_cast<int>(raw[4]));
 
-  mbedtls_ccm_free(&ctx);
   return true;
 }
 
@@ -365,14 +375,74 @@ bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std:
 }
 
 bool XiaomiListener::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
-  // Previously the message was parsed twice per packet, once by XiaomiListener::parse_device()
-  // and then again by the respective device class's parse_device() function. Parsing the header
-  // here and then for each device seems to be unnecessary and complicates the duplicate packet filtering.
-  // Hence I disabled the call to parse_xiaomi_header() here and the message parsing is done entirely
-  // in the respective device instance. The XiaomiListener class is defined in __init__.py and I was not
-  // able to remove it entirely.
-
-  return false;  // with true it's not showing device scans
+  auto it = this->devices_.find(device.address_uint64());
+  if (it == this->devices_.end()) {
+    ESP_LOGVV(TAG, "parse_device(): unknown MAC address.");
+    return false;
+  }
+  ESP_LOGVV(TAG, "parse_device(): MAC address %s found.", device.address_str().c_str());
+
+  bool success = false;
+  for (uint8_t i = 0; i < device.get_adv_field_count(); i++) {
+    const esp32_ble_tracker::ESPBTAdvField field = device.get_adv_field(i);
+    if (field.type != ESP_BLE_AD_TYPE_SERVICE_DATA || field.length < 2 || field.data[0] != 0x95 ||
+        field.data[1] != 0xFE)
+      continue;
+
+    // Decrypted in a copy, the advertisement itself is shared with the other listeners
+    uint8_t raw[ESP_BLE_ADV_DATA_LEN_MAX];
+    const uint8_t length = field.length - 2;
+    if (length > sizeof(raw)) {
+      ESP_LOGVV(TAG, "parse_device(): service data too long (%u bytes).", length);
+      continue;
+    }
+
+    // Each device filters duplicate packets and decrypts with its own bindkey
+    for (XiaomiDevice *xiaomi : it->second) {
+      memcpy(raw, field.data + 2, length);
+      auto res = parse_xiaomi_header(raw, length, xiaomi->last_frame_count_);
+      if (!res.has_value()) {
+        continue;
+      }
+      if (res->has_encryption) {
+        if (!xiaomi->has_bindkey_) {
+          ESP_LOGVV(TAG, "parse_device(): payload is encrypted, but no bindkey is configured.");
+          continue;
+        }
+        if (!decrypt_xiaomi_payload(raw, length, &xiaomi->ccm_, xiaomi->address_)) {
+          continue;
+        }
+      }
+      if (!parse_xiaomi_message(raw, length, *res)) {
+        continue;
+      }
+      if (!report_xiaomi_results(res, device.address_str())) {
+        continue;
+      }
+      if (xiaomi->process_xiaomi_result(*res))
+        success = true;
+    }
+  }
+
+  return success;
+}
+
+void XiaomiDevice::set_bindkey(const std::string &bindkey) {
+  memset(this->bindkey_, 0, 16);
+  this->has_bindkey_ = false;
+  if (bindkey.size() != 32) {
+    return;
+  }
+  char temp[3] = {0};
+  for (int i = 0; i < 16; i++) {
+    strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
+    this->bindkey_[i] = std::strtoul(temp, nullptr, 16);
+  }
+  if (mbedtls_ccm_setkey(&this->ccm_, MBEDTLS_CIPHER_ID_AES, this->bindkey_, 16 * 8) != 0) {
+    ESP_LOGW(TAG, "Could not set up the bindkey");
+    return;
+  }
+  this->has_bindkey_ = true;
 }
 
 }  // namespace xiaomi_ble
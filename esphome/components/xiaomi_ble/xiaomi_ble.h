@@ -5,6 +5,10 @@
 
 #ifdef USE_ESP32
 
+#include <unordered_map>
+#include <vector>
+#include "mbedtls/ccm.h"
+
 namespace esphome {
 namespace xiaomi_ble {
 
@@ -64,14 +68,51 @@ struct XiaomiAESVector {
 };
 
 bool parse_xiaomi_value(uint16_t value_type, const uint8_t *data, uint8_t value_length, XiaomiParseResult &result);
+bool parse_xiaomi_message(const uint8_t *message, uint8_t length, XiaomiParseResult &result);
 bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult &result);
+/// Parse the header of the payload of 0xFE95 service data, last_frame_count is updated to filter duplicate packets.
+optional<XiaomiParseResult> parse_xiaomi_header(const uint8_t *raw, uint8_t length, int16_t &last_frame_count);
 optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data);
+/// Decrypt the payload in place with a CCM context that has the bindkey set already.
+bool decrypt_xiaomi_payload(uint8_t *raw, uint8_t length, mbedtls_ccm_context *ctx, const uint64_t &address);
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address);
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address);
 
+/// A Xiaomi device with a known MAC address. XiaomiListener decrypts and parses its advertisements once and passes the
+/// results to process_xiaomi_result().
+class XiaomiDevice {
+ public:
+  XiaomiDevice() { mbedtls_ccm_init(&this->ccm_); }
+  virtual ~XiaomiDevice() { mbedtls_ccm_free(&this->ccm_); }
+
+  void set_address(uint64_t address) { this->address_ = address; }
+  uint64_t get_address() const { return this->address_; }
+  void set_bindkey(const std::string &bindkey);
+
+  virtual bool process_xiaomi_result(const XiaomiParseResult &result) = 0;
+
+ protected:
+  friend class XiaomiListener;
+
+  uint64_t address_{0};
+  uint8_t bindkey_[16]{};
+  bool has_bindkey_{false};
+  /// The key schedule is set up once here, not for every advertisement
+  mbedtls_ccm_context ccm_;
+  int16_t last_frame_count_{-1};
+};
+
+/// Looks up the XiaomiDevice of each advertisement with Xiaomi service data by its address.
 class XiaomiListener : public esp32_ble_tracker::ESPBTDeviceListener {
  public:
+  XiaomiListener() { this->add_device_filter_service_uuid(esp32_ble_tracker::ESPBTUUID::from_uint16(0xFE95)); }
+
+  void register_device(XiaomiDevice *device) { this->devices_[device->get_address()].push_back(device); }
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+
+ protected:
+  /// Several components can read the same device, e.g. a sensor and a binary sensor.
+  std::unordered_map<uint64_t, std::vector<XiaomiDevice *>> devices_;
 };
 
 }  // namespace xiaomi_ble
@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import sensor, esp32_ble_tracker
+from esphome.components import sensor, xiaomi_ble
 from esphome.const import (
     CONF_BATTERY_LEVEL,
     CONF_HUMIDITY,
@@ -22,7 +22,7 @@ AUTO_LOAD = ["xiaomi_ble"]
 
 xiaomi_cgd1_ns = cg.esphome_ns.namespace("xiaomi_cgd1")
 XiaomiCGD1 = xiaomi_cgd1_ns.class_(
-    "XiaomiCGD1", esp32_ble_tracker.ESPBTDeviceListener, cg.Component
+    "XiaomiCGD1", xiaomi_ble.XiaomiDevice, cg.Component
 )
 
 CONFIG_SCHEMA = (
@@ -52,7 +52,7 @@ CONFIG_SCHEMA = (
             ),
         }
     )
-    .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
+    .extend(xiaomi_ble.XIAOMI_BLE_DEVICE_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -60,10 +60,7 @@ CONFIG_SCHEMA = (
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
-    await esp32_ble_tracker.register_ble_device(var, config)
-
-    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
-    cg.add(var.set_bindkey(config[CONF_BINDKEY]))
+    await xiaomi_ble.register_xiaomi_device(var, config)
 
     if CONF_TEMPERATURE in config:
         sens = await sensor.new_sensor(config[CONF_TEMPERATURE])
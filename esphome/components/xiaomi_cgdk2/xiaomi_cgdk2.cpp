@@ -16,55 +16,14 @@ void XiaomiCGDK2::dump_config() {
   LOG_SENSOR("  ", "Battery Level", this->battery_level_);
 }
 
-bool XiaomiCGDK2::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
-  if (device.address_uint64() != this->address_) {
-    ESP_LOGVV(TAG, "parse_device(): unknown MAC address.");
-    return false;
-  }
-  ESP_LOGV(TAG, "parse_device(): MAC address %s found.", device.address_str().c_str());
-
-  bool success = false;
-  for (auto &service_data : device.get_service_datas()) {
-    auto res = xiaomi_ble::parse_xiaomi_header(service_data);
-    if (!res.has_value()) {
-      continue;
-    }
-    if (res->is_duplicate) {
-      continue;
-    }
-    if (res->has_encryption &&
-        (!(xiaomi_ble::decrypt_xiaomi_payload(const_cast<std::vector<uint8_t> &>(service_data.data), this->bindkey_,
-                                              this->address_)))) {
-      continue;
-    }
-    if (!(xiaomi_ble::parse_xiaomi_message(service_data.data, *res))) {
-      continue;
-    }
-    if (!(xiaomi_ble::report_xiaomi_results(res, device.address_str()))) {
-      continue;
-    }
-    if (res->temperature.has_value() && this->temperature_ != nullptr)
-      this->temperature_->publish_state(*res->temperature);
-    if (res->humidity.has_value() && this->humidity_ != nullptr)
-      this->humidity_->publish_state(*res->humidity);
-    if (res->battery_level.has_value() && this->battery_level_ != nullptr)
-      this->battery_level_->publish_state(*res->battery_level);
-    success = true;
-  }
-
-  return success;
-}
-
-void XiaomiCGDK2::set_bindkey(const std::string &bindkey) {
-  memset(bindkey_, 0, 16);
-  if (bindkey.size() != 32) {
-    return;
-  }
-  char temp[3] = {0};
-  for (int i = 0; i < 16; i++) {
-    strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
-    bindkey_[i] = std::strtoul(temp, nullptr, 16);
-  }
+bool XiaomiCGDK2::process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) {
+  if (result.temperature.has_value() && this->temperature_ != nullptr)
+    this->temperature_->publish_state(*result.temperature);
+  if (result.humidity.has_value() && this->humidity_ != nullptr)
+    this->humidity_->publish_state(*result.humidity);
+  if (result.battery_level.has_value() && this->battery_level_ != nullptr)
+    this->battery_level_->publish_state(*result.battery_level);
+  return true;
 }
 
 }  // namespace xiaomi_cgdk2
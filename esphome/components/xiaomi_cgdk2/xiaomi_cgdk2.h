@@ -10,12 +10,9 @@
 namespace esphome {
 namespace xiaomi_cgdk2 {
 
-class XiaomiCGDK2 : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiCGDK2 : public Component, public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; };
-  void set_bindkey(const std::string &bindkey);
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   void set_temperature(sensor::Sensor *temperature) { temperature_ = temperature; }
@@ -23,8 +20,6 @@ class XiaomiCGDK2 : public Component, public esp32_ble_tracker::ESPBTDeviceListe
   void set_battery_level(sensor::Sensor *battery_level) { battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
-  uint8_t bindkey_[16];
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
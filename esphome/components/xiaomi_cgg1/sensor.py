@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import sensor, esp32_ble_tracker
+from esphome.components import sensor, xiaomi_ble
 from esphome.const import (
     CONF_BATTERY_LEVEL,
     CONF_BINDKEY,
@@ -22,7 +22,7 @@ AUTO_LOAD = ["xiaomi_ble"]
 
 xiaomi_cgg1_ns = cg.esphome_ns.namespace("xiaomi_cgg1")
 XiaomiCGG1 = xiaomi_cgg1_ns.class_(
-    "XiaomiCGG1", esp32_ble_tracker.ESPBTDeviceListener, cg.Component
+    "XiaomiCGG1", xiaomi_ble.XiaomiDevice, cg.Component
 )
 
 CONFIG_SCHEMA = (
@@ -52,7 +52,7 @@ CONFIG_SCHEMA = (
             ),
         }
     )
-    .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
+    .extend(xiaomi_ble.XIAOMI_BLE_DEVICE_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -60,12 +60,10 @@ CONFIG_SCHEMA = (
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
-    await esp32_ble_tracker.register_ble_device(var, config)
+    await xiaomi_ble.register_xiaomi_device(var, config)
 
-    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
     if CONF_BINDKEY in config:
-        cg.add(var.set_bindkey(config[CONF_BINDKEY]))
-
+    
     if CONF_TEMPERATURE in config:
         sens = await sensor.new_sensor(config[CONF_TEMPERATURE])
         cg.add(var.set_temperature(sens))
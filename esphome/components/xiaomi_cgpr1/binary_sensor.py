@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import sensor, binary_sensor, esp32_ble_tracker
+from esphome.components import sensor, binary_sensor, xiaomi_ble
 from esphome.const import (
     CONF_BATTERY_LEVEL,
     CONF_BINDKEY,
@@ -25,7 +25,7 @@ XiaomiCGPR1 = xiaomi_cgpr1_ns.class_(
     "XiaomiCGPR1",
     binary_sensor.BinarySensor,
     cg.Component,
-    esp32_ble_tracker.ESPBTDeviceListener,
+    xiaomi_ble.XiaomiDevice,
 )
 
 CONFIG_SCHEMA = cv.All(
@@ -53,7 +53,7 @@ CONFIG_SCHEMA = cv.All(
             ),
         }
     )
-    .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
+    .extend(xiaomi_ble.XIAOMI_BLE_DEVICE_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -61,10 +61,7 @@ CONFIG_SCHEMA = cv.All(
 async def to_code(config):
     var = await binary_sensor.new_binary_sensor(config)
     await cg.register_component(var, config)
-    await esp32_ble_tracker.register_ble_device(var, config)
-
-    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
-    cg.add(var.set_bindkey(config[CONF_BINDKEY]))
+    await xiaomi_ble.register_xiaomi_device(var, config)
 
     if CONF_IDLE_TIME in config:
         sens = await sensor.new_sensor(config[CONF_IDLE_TIME])
@@ -16,57 +16,16 @@ void XiaomiCGPR1::dump_config() {
   LOG_SENSOR("  ", "Illuminance", this->illuminance_);
 }
 
-bool XiaomiCGPR1::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
-  if (device.address_uint64() != this->address_) {
-    ESP_LOGVV(TAG, "parse_device(): unknown MAC address.");
-    return false;
-  }
-  ESP_LOGVV(TAG, "parse_device(): MAC address %s found.", device.address_str().c_str());
-
-  bool success = false;
-  for (auto &service_data : device.get_service_datas()) {
-    auto res = xiaomi_ble::parse_xiaomi_header(service_data);
-    if (!res.has_value()) {
-      continue;
-    }
-    if (res->is_duplicate) {
-      continue;
-    }
-    if (res->has_encryption &&
-        (!(xiaomi_ble::decrypt_xiaomi_payload(const_cast<std::vector<uint8_t> &>(service_data.data), this->bindkey_,
-                                              this->address_)))) {
-      continue;
-    }
-    if (!(xiaomi_ble::parse_xiaomi_message(service_data.data, *res))) {
-      continue;
-    }
-    if (!(xiaomi_ble::report_xiaomi_results(res, device.address_str()))) {
-      continue;
-    }
-    if (res->idle_time.has_value() && this->idle_time_ != nullptr)
-      this->idle_time_->publish_state(*res->idle_time);
-    if (res->battery_level.has_value() && this->battery_level_ != nullptr)
-      this->battery_level_->publish_state(*res->battery_level);
-    if (res->illuminance.has_value() && this->illuminance_ != nullptr)
-      this->illuminance_->publish_state(*res->illuminance);
-    if (res->has_motion.has_value())
-      this->publish_state(*res->has_motion);
-    success = true;
-  }
-
-  return success;
-}
-
-void XiaomiCGPR1::set_bindkey(const std::string &bindkey) {
-  memset(bindkey_, 0, 16);
-  if (bindkey.size() != 32) {
-    return;
-  }
-  char temp[3] = {0};
-  for (int i = 0; i < 16; i++) {
-    strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
-    bindkey_[i] = std::strtoul(temp, nullptr, 16);
-  }
+bool XiaomiCGPR1::process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) {
+  if (result.idle_time.has_value() && this->idle_time_ != nullptr)
+    this->idle_time_->publish_state(*result.idle_time);
+  if (result.battery_level.has_value() && this->battery_level_ != nullptr)
+    this->battery_level_->publish_state(*result.battery_level);
+  if (result.illuminance.has_value() && this->illuminance_ != nullptr)
+    this->illuminance_->publish_state(*result.illuminance);
+  if (result.has_motion.has_value())
+    this->publish_state(*result.has_motion);
+  return true;
 }
 
 }  // namespace xiaomi_cgpr1
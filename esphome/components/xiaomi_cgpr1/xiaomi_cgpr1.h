@@ -13,12 +13,9 @@ namespace xiaomi_cgpr1 {
 
 class XiaomiCGPR1 : public Component,
                     public binary_sensor::BinarySensorInitiallyOff,
-                    public esp32_ble_tracker::ESPBTDeviceListener {
+                    public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-  void set_bindkey(const std::string &bindkey);
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
 
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -27,8 +24,6 @@ class XiaomiCGPR1 : public Component,
   void set_idle_time(sensor::Sensor *idle_time) { idle_time_ = idle_time; }
 
  protected:
-  uint64_t address_;
-  uint8_t bindkey_[16];
   sensor::Sensor *idle_time_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
   sensor::Sensor *illuminance_{nullptr};
@@ -17,46 +17,18 @@ void XiaomiHHCCJCY01::dump_config() {
   LOG_SENSOR("  ", "Battery Level", this->battery_level_);
 }
 
-bool XiaomiHHCCJCY01::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
-  if (device.address_uint64() != this->address_) {
-    ESP_LOGVV(TAG, "parse_device(): unknown MAC address.");
-    return false;
-  }
-  ESP_LOGVV(TAG, "parse_device(): MAC address %s found.", device.address_str().c_str());
-
-  bool success = false;
-  for (auto &service_data : device.get_service_datas()) {
-    auto res = xiaomi_ble::parse_xiaomi_header(service_data);
-    if (!res.has_value()) {
-      continue;
-    }
-    if (res->is_duplicate) {
-      continue;
-    }
-    if (res->has_encryption) {
-      ESP_LOGVV(TAG, "parse_device(): payload decryption is currently not supported on this device.");
-      continue;
-    }
-    if (!(xiaomi_ble::parse_xiaomi_message(service_data.data, *res))) {
-      continue;
-    }
-    if (!(xiaomi_ble::report_xiaomi_results(res, device.address_str()))) {
-      continue;
-    }
-    if (res->temperature.has_value() && this->temperature_ != nullptr)
-      this->temperature_->publish_state(*res->temperature);
-    if (res->moisture.has_value() && this->moisture_ != nullptr)
-      this->moisture_->publish_state(*res->moisture);
-    if (res->conductivity.has_value() && this->conductivity_ != nullptr)
-      this->conductivity_->publish_state(*res->conductivity);
-    if (res->illuminance.has_value() && this->illuminance_ != nullptr)
-      this->illuminance_->publish_state(*res->illuminance);
-    if (res->battery_level.has_value() && this->battery_level_ != nullptr)
-      this->battery_level_->publish_state(*res->battery_level);
-    success = true;
-  }
-
-  return success;
+bool XiaomiHHCCJCY01::process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) {
+  if (result.temperature.has_value() && this->temperature_ != nullptr)
+    this->temperature_->publish_state(*result.temperature);
+  if (result.moisture.has_value() && this->moisture_ != nullptr)
+    this->moisture_->publish_state(*result.moisture);
+  if (result.conductivity.has_value() && this->conductivity_ != nullptr)
+    this->conductivity_->publish_state(*result.conductivity);
+  if (result.illuminance.has_value() && this->illuminance_ != nullptr)
+    this->illuminance_->publish_state(*result.illuminance);
+  if (result.battery_level.has_value() && this->battery_level_ != nullptr)
+    this->battery_level_->publish_state(*result.battery_level);
+  return true;
 }
 
 }  // namespace xiaomi_hhccjcy01
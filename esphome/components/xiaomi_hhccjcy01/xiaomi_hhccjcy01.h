@@ -10,11 +10,9 @@
 namespace esphome {
 namespace xiaomi_hhccjcy01 {
 
-class XiaomiHHCCJCY01 : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiHHCCJCY01 : public Component, public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
 
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -25,7 +23,6 @@ class XiaomiHHCCJCY01 : public Component, public esp32_ble_tracker::ESPBTDeviceL
   void set_battery_level(sensor::Sensor *battery_level) { battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *moisture_{nullptr};
   sensor::Sensor *conductivity_{nullptr};
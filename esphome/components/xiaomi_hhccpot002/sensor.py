@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import sensor, esp32_ble_tracker
+from esphome.components import sensor, xiaomi_ble
 from esphome.const import (
     CONF_MAC_ADDRESS,
     STATE_CLASS_MEASUREMENT,
@@ -18,7 +18,7 @@ AUTO_LOAD = ["xiaomi_ble"]
 
 xiaomi_hhccpot002_ns = cg.esphome_ns.namespace("xiaomi_hhccpot002")
 XiaomiHHCCPOT002 = xiaomi_hhccpot002_ns.class_(
-    "XiaomiHHCCPOT002", esp32_ble_tracker.ESPBTDeviceListener, cg.Component
+    "XiaomiHHCCPOT002", xiaomi_ble.XiaomiDevice, cg.Component
 )
 
 CONFIG_SCHEMA = (
@@ -40,7 +40,7 @@ CONFIG_SCHEMA = (
             ),
         }
     )
-    .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
+    .extend(xiaomi_ble.XIAOMI_BLE_DEVICE_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -48,9 +48,7 @@ CONFIG_SCHEMA = (
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
-    await esp32_ble_tracker.register_ble_device(var, config)
-
-    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
+    await xiaomi_ble.register_xiaomi_device(var, config)
 
     if CONF_MOISTURE in config:
         sens = await sensor.new_sensor(config[CONF_MOISTURE])
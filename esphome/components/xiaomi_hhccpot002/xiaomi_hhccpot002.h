@@ -10,11 +10,9 @@
 namespace esphome {
 namespace xiaomi_hhccpot002 {
 
-class XiaomiHHCCPOT002 : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiHHCCPOT002 : public Component, public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
 
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -22,7 +20,6 @@ class XiaomiHHCCPOT002 : public Component, public esp32_ble_tracker::ESPBTDevice
   void set_conductivity(sensor::Sensor *conductivity) { conductivity_ = conductivity; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *moisture_{nullptr};
   sensor::Sensor *conductivity_{nullptr};
 };
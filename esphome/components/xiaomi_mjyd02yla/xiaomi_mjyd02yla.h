@@ -13,12 +13,9 @@ namespace xiaomi_mjyd02yla {
 
 class XiaomiMJYD02YLA : public Component,
                         public binary_sensor::BinarySensorInitiallyOff,
-                        public esp32_ble_tracker::ESPBTDeviceListener {
+                        public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-  void set_bindkey(const std::string &bindkey);
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
 
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -28,8 +25,6 @@ class XiaomiMJYD02YLA : public Component,
   void set_light(binary_sensor::BinarySensor *light) { is_light_ = light; }
 
  protected:
-  uint64_t address_;
-  uint8_t bindkey_[16];
   sensor::Sensor *idle_time_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
   sensor::Sensor *illuminance_{nullptr};
@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import binary_sensor, esp32_ble_tracker
+from esphome.components import binary_sensor, xiaomi_ble
 from esphome.const import (
     CONF_MAC_ADDRESS,
     CONF_TIMEOUT,
@@ -16,7 +16,7 @@ XiaomiMUE4094RT = xiaomi_mue4094rt_ns.class_(
     "XiaomiMUE4094RT",
     binary_sensor.BinarySensor,
     cg.Component,
-    esp32_ble_tracker.ESPBTDeviceListener,
+    xiaomi_ble.XiaomiDevice,
 )
 
 CONFIG_SCHEMA = cv.All(
@@ -31,7 +31,7 @@ CONFIG_SCHEMA = cv.All(
             ): cv.positive_time_period_milliseconds,
         }
     )
-    .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
+    .extend(xiaomi_ble.XIAOMI_BLE_DEVICE_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -39,7 +39,6 @@ CONFIG_SCHEMA = cv.All(
 async def to_code(config):
     var = await binary_sensor.new_binary_sensor(config)
     await cg.register_component(var, config)
-    await esp32_ble_tracker.register_ble_device(var, config)
+    await xiaomi_ble.register_xiaomi_device(var, config)
 
-    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
     cg.add(var.set_time(config[CONF_TIMEOUT]))
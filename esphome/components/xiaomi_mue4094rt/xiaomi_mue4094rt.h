@@ -12,18 +12,15 @@ namespace xiaomi_mue4094rt {
 
 class XiaomiMUE4094RT : public Component,
                         public binary_sensor::BinarySensorInitiallyOff,
-                        public esp32_ble_tracker::ESPBTDeviceListener {
+                        public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
 
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   void set_time(uint16_t timeout) { timeout_ = timeout; }
 
  protected:
-  uint64_t address_;
   uint16_t timeout_;
 };
 
@@ -16,12 +16,9 @@
 namespace esphome {
 namespace xiaomi_rtcgq02lm {
 
-class XiaomiRTCGQ02LM : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
+class XiaomiRTCGQ02LM : public Component, public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; };
-  void set_bindkey(const std::string &bindkey);
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
 
@@ -39,8 +36,6 @@ class XiaomiRTCGQ02LM : public Component, public esp32_ble_tracker::ESPBTDeviceL
 #endif
 
  protected:
-  uint64_t address_;
-  uint8_t bindkey_[16];
 
 #ifdef USE_BINARY_SENSOR
   uint16_t motion_timeout_;
@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import sensor, binary_sensor, esp32_ble_tracker
+from esphome.components import sensor, binary_sensor, xiaomi_ble
 from esphome.const import (
     CONF_BATTERY_LEVEL,
     CONF_MAC_ADDRESS,
@@ -20,7 +20,7 @@ xiaomi_wx08zm_ns = cg.esphome_ns.namespace("xiaomi_wx08zm")
 XiaomiWX08ZM = xiaomi_wx08zm_ns.class_(
     "XiaomiWX08ZM",
     binary_sensor.BinarySensor,
-    esp32_ble_tracker.ESPBTDeviceListener,
+    xiaomi_ble.XiaomiDevice,
     cg.Component,
 )
 
@@ -44,7 +44,7 @@ CONFIG_SCHEMA = cv.All(
             ),
         }
     )
-    .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
+    .extend(xiaomi_ble.XIAOMI_BLE_DEVICE_SCHEMA)
     .extend(cv.COMPONENT_SCHEMA)
 )
 
@@ -52,9 +52,7 @@ CONFIG_SCHEMA = cv.All(
 async def to_code(config):
     var = await binary_sensor.new_binary_sensor(config)
     await cg.register_component(var, config)
-    await esp32_ble_tracker.register_ble_device(var, config)
-
-    cg.add(var.set_address(config[CONF_MAC_ADDRESS].as_hex))
+    await xiaomi_ble.register_xiaomi_device(var, config)
 
     if CONF_TABLET in config:
         sens = await sensor.new_sensor(config[CONF_TABLET])
@@ -13,11 +13,9 @@ namespace xiaomi_wx08zm {
 
 class XiaomiWX08ZM : public Component,
                      public binary_sensor::BinarySensorInitiallyOff,
-                     public esp32_ble_tracker::ESPBTDeviceListener {
+                     public xiaomi_ble::XiaomiDevice {
  public:
-  void set_address(uint64_t address) { address_ = address; }
-
-  bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
+  bool process_xiaomi_result(const xiaomi_ble::XiaomiParseResult &result) override;
 
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -25,7 +23,6 @@ class XiaomiWX08ZM : public Component,
   void set_battery_level(sensor::Sensor *battery_level) { battery_level_ = battery_level; }
 
  protected:
-  uint64_t address_;
   sensor::Sensor *tablet_{nullptr};
   sensor::Sensor *battery_level_{nullptr};
 };
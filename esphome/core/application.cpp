@@ -7,6 +7,10 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include "esphome/components/socket/socket.h"
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
@@ -65,6 +69,9 @@ void Application::setup() {
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
+#ifdef USE_LOOP_TIME_STATS
+  const uint32_t loop_start = micros();
+#endif
 
   this->scheduler.call();
   this->feed_wdt();
@@ -80,8 +87,15 @@ void Application::loop() {
   this->app_state_ = new_app_state;
 
   const uint32_t now = millis();
+#ifdef USE_LOOP_TIME_STATS
+  this->loop_time_stats_.add(micros() - loop_start);
+#endif
 
   if (HighFrequencyLoopRequester::is_high_frequency()) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    // Only refresh which sockets are readable, without sleeping
+    socket::wait_for_readiness(0);
+#endif
     yield();
   } else {
     uint32_t delay_time = this->loop_interval_;
@@ -93,7 +107,13 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    // Sleep in select(), so that incoming data wakes up the loop right away
+    if (!socket::wait_for_readiness(delay_time))
+      delay(delay_time);
+#else
     delay(delay_time);
+#endif
   }
   this->last_loop_ = now;
 
@@ -152,6 +172,22 @@ void Application::calculate_looping_components_() {
   }
 }
 
+#ifdef USE_LOOP_TIME_STATS
+const uint32_t LoopTimeStats::BUCKET_BOUNDS_US[LoopTimeStats::BUCKET_COUNT] = {1000,  5000,   10000, 25000,
+                                                                               50000, 100000, 250000};
+
+void LoopTimeStats::add(uint32_t duration_us) {
+  for (size_t i = 0; i < BUCKET_COUNT; i++) {
+    if (duration_us <= BUCKET_BOUNDS_US[i]) {
+      this->buckets[i]++;
+      break;
+    }
+  }
+  this->count++;
+  this->sum_us += duration_us;
+}
+#endif
+
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "esphome/core/defines.h"
@@ -51,6 +52,27 @@
 
 namespace esphome {
 
+/// Registration indices of the entities of one domain, sorted by key. Generated by codegen.
+struct EntityKeyOrder {
+  const uint16_t *order;
+  uint16_t size;
+};
+
+#ifdef USE_LOOP_TIME_STATS
+/// Histogram of the time the active part of Application::loop() takes, without the sleep until the next loop.
+struct LoopTimeStats {
+  static const size_t BUCKET_COUNT = 7;
+  /// Upper bounds of the buckets in microseconds, loops that take longer only count towards count and sum_us.
+  static const uint32_t BUCKET_BOUNDS_US[BUCKET_COUNT];
+
+  uint32_t buckets[BUCKET_COUNT];  ///< Number of loops per bucket, not cumulative.
+  uint32_t count;
+  uint64_t sum_us;
+
+  void add(uint32_t duration_us);
+};
+#endif
+
 class Application {
  public:
   void pre_setup(const std::string &name, const char *compilation_time, bool name_add_mac_suffix) {
@@ -68,54 +90,93 @@ class Application {
   void register_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
     this->binary_sensors_.push_back(binary_sensor);
   }
+  void set_binary_sensor_key_order(const uint16_t *order, uint16_t size) {
+    this->binary_sensor_key_order_ = make_key_order_(this->binary_sensors_, order, size);
+  }
 #endif
 
 #ifdef USE_SENSOR
   void register_sensor(sensor::Sensor *sensor) { this->sensors_.push_back(sensor); }
+  void set_sensor_key_order(const uint16_t *order, uint16_t size) {
+    this->sensor_key_order_ = make_key_order_(this->sensors_, order, size);
+  }
 #endif
 
 #ifdef USE_SWITCH
   void register_switch(switch_::Switch *a_switch) { this->switches_.push_back(a_switch); }
+  void set_switch_key_order(const uint16_t *order, uint16_t size) {
+    this->switch_key_order_ = make_key_order_(this->switches_, order, size);
+  }
 #endif
 
 #ifdef USE_BUTTON
   void register_button(button::Button *button) { this->buttons_.push_back(button); }
+  void set_button_key_order(const uint16_t *order, uint16_t size) {
+    this->button_key_order_ = make_key_order_(this->buttons_, order, size);
+  }
 #endif
 
 #ifdef USE_TEXT_SENSOR
   void register_text_sensor(text_sensor::TextSensor *sensor) { this->text_sensors_.push_back(sensor); }
+  void set_text_sensor_key_order(const uint16_t *order, uint16_t size) {
+    this->text_sensor_key_order_ = make_key_order_(this->text_sensors_, order, size);
+  }
 #endif
 
 #ifdef USE_FAN
   void register_fan(fan::Fan *state) { this->fans_.push_back(state); }
+  void set_fan_key_order(const uint16_t *order, uint16_t size) {
+    this->fan_key_order_ = make_key_order_(this->fans_, order, size);
+  }
 #endif
 
 #ifdef USE_COVER
   void register_cover(cover::Cover *cover) { this->covers_.push_back(cover); }
+  void set_cover_key_order(const uint16_t *order, uint16_t size) {
+    this->cover_key_order_ = make_key_order_(this->covers_, order, size);
+  }
 #endif
 
 #ifdef USE_CLIMATE
   void register_climate(climate::Climate *climate) { this->climates_.push_back(climate); }
+  void set_climate_key_order(const uint16_t *order, uint16_t size) {
+    this->climate_key_order_ = make_key_order_(this->climates_, order, size);
+  }
 #endif
 
 #ifdef USE_LIGHT
   void register_light(light::LightState *light) { this->lights_.push_back(light); }
+  void set_light_key_order(const uint16_t *order, uint16_t size) {
+    this->light_key_order_ = make_key_order_(this->lights_, order, size);
+  }
 #endif
 
 #ifdef USE_NUMBER
   void register_number(number::Number *number) { this->numbers_.push_back(number); }
+  void set_number_key_order(const uint16_t *order, uint16_t size) {
+    this->number_key_order_ = make_key_order_(this->numbers_, order, size);
+  }
 #endif
 
 #ifdef USE_SELECT
   void register_select(select::Select *select) { this->selects_.push_back(select); }
+  void set_select_key_order(const uint16_t *order, uint16_t size) {
+    this->select_key_order_ = make_key_order_(this->selects_, order, size);
+  }
 #endif
 
 #ifdef USE_LOCK
   void register_lock(lock::Lock *a_lock) { this->locks_.push_back(a_lock); }
+  void set_lock_key_order(const uint16_t *order, uint16_t size) {
+    this->lock_key_order_ = make_key_order_(this->locks_, order, size);
+  }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   void register_media_player(media_player::MediaPlayer *media_player) { this->media_players_.push_back(media_player); }
+  void set_media_player_key_order(const uint16_t *order, uint16_t size) {
+    this->media_player_key_order_ = make_key_order_(this->media_players_, order, size);
+  }
 #endif
 
   /// Register the component in this Application instance.
@@ -168,121 +229,86 @@ class Application {
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->binary_sensors_, this->binary_sensor_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->switches_, this->switch_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_BUTTON
   const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
   button::Button *get_button_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->buttons_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->buttons_, this->button_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->sensors_, this->sensor_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->text_sensors_, this->text_sensor_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
   fan::Fan *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->fans_, this->fan_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->covers_, this->cover_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->lights_, this->light_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->climates_, this->climate_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->numbers_, this->number_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_SELECT
   const std::vector<select::Select *> &get_selects() { return this->selects_; }
   select::Select *get_select_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->selects_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->selects_, this->select_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_LOCK
   const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
   lock::Lock *get_lock_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->locks_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->locks_, this->lock_key_order_, key, include_internal);
   }
 #endif
 #ifdef USE_MEDIA_PLAYER
   const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
   media_player::MediaPlayer *get_media_player_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->media_players_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return get_by_key_(this->media_players_, this->media_player_key_order_, key, include_internal);
   }
 #endif
 
+#ifdef USE_LOOP_TIME_STATS
+  const LoopTimeStats &get_loop_time_stats() const { return this->loop_time_stats_; }
+#endif
+
   Scheduler scheduler;
 
  protected:
@@ -294,47 +320,100 @@ class Application {
 
   void feed_wdt_arch_();
 
+  /// Use \p order for the key lookups of \p entities, unless they were registered in a different order than codegen
+  /// generated it for.
+  template<class T>
+  static EntityKeyOrder make_key_order_(const std::vector<T *> &entities, const uint16_t *order, uint16_t size) {
+    if (size > entities.size())
+      return {nullptr, 0};
+    for (uint16_t i = 1; i < size; i++) {
+      // Look the entities up linearly instead
+      if (entities[order[i - 1]]->get_object_id_hash() > entities[order[i]]->get_object_id_hash())
+        return {nullptr, 0};
+    }
+    return {order, size};
+  }
+
+  /** Find an entity by key with a binary search over the key order generated by codegen.
+   *
+   * Only entities registered after the order was generated aren't in it, these are searched linearly. The keys must
+   * not change afterwards, entities are not renamed after setup.
+   */
+  template<class T>
+  static T *get_by_key_(const std::vector<T *> &entities, const EntityKeyOrder &key_order, uint32_t key,
+                        bool include_internal) {
+    const uint16_t *end = key_order.order + key_order.size;
+    const uint16_t *it = std::lower_bound(key_order.order, end, key, [&entities](uint16_t index, uint32_t key) {
+      return entities[index]->get_object_id_hash() < key;
+    });
+    // Keys are only unique among the entities that are not internal
+    for (; it != end && entities[*it]->get_object_id_hash() == key; it++) {
+      T *obj = entities[*it];
+      if (include_internal || !obj->is_internal())
+        return obj;
+    }
+    for (size_t i = key_order.size; i < entities.size(); i++) {
+      T *obj = entities[i];
+      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
+        return obj;
+    }
+    return nullptr;
+  }
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityKeyOrder binary_sensor_key_order_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityKeyOrder switch_key_order_{};
 #endif
 #ifdef USE_BUTTON
   std::vector<button::Button *> buttons_{};
+  EntityKeyOrder button_key_order_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityKeyOrder sensor_key_order_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityKeyOrder text_sensor_key_order_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::Fan *> fans_{};
+  EntityKeyOrder fan_key_order_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityKeyOrder cover_key_order_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityKeyOrder climate_key_order_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityKeyOrder light_key_order_{};
 #endif
 #ifdef USE_NUMBER
   std::vector<number::Number *> numbers_{};
+  EntityKeyOrder number_key_order_{};
 #endif
 #ifdef USE_SELECT
   std::vector<select::Select *> selects_{};
+  EntityKeyOrder select_key_order_{};
 #endif
 #ifdef USE_LOCK
   std::vector<lock::Lock *> locks_{};
+  EntityKeyOrder lock_key_order_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
   std::vector<media_player::MediaPlayer *> media_players_{};
+  EntityKeyOrder media_player_key_order_{};
 #endif
 
   std::string name_;
@@ -344,6 +423,9 @@ class Application {
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+#ifdef USE_LOOP_TIME_STATS
+  LoopTimeStats loop_time_stats_{};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
@@ -0,0 +1,50 @@
+#include "esphome/core/crc.h"
+
+namespace esphome {
+
+// The CRCs process a nibble per table lookup. Tables for a byte per lookup are 16 times larger, and would have to be
+// kept in RAM on the ESP8266.
+static const uint8_t CRC8_TABLE[16] = {0x00, 0x9D, 0x23, 0xBE, 0x46, 0xDB, 0x65, 0xF8,
+                                       0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74};
+static const uint16_t CRC16_TABLE[16] = {0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+                                         0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400};
+static const uint16_t CRC16_CCITT_TABLE[16] = {0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+                                               0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+static const uint32_t CRC32_TABLE[16] = {0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+                                         0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+                                         0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+uint8_t crc8(const uint8_t *data, size_t len, uint8_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ CRC8_TABLE[crc & 0x0F];
+    crc = (crc >> 4) ^ CRC8_TABLE[crc & 0x0F];
+  }
+  return crc;
+}
+uint16_t crc16(const uint8_t *data, size_t len, uint16_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ CRC16_TABLE[crc & 0x0F];
+    crc = (crc >> 4) ^ CRC16_TABLE[crc & 0x0F];
+  }
+  return crc;
+}
+uint16_t crc16_ccitt(const uint8_t *data, size_t len, uint16_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc = (crc << 4) ^ CRC16_CCITT_TABLE[(crc >> 12) ^ (data[i] >> 4)];
+    crc = (crc << 4) ^ CRC16_CCITT_TABLE[(crc >> 12) ^ (data[i] & 0x0F)];
+  }
+  return crc;
+}
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ CRC32_TABLE[crc & 0x0F];
+    crc = (crc >> 4) ^ CRC32_TABLE[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+}  // namespace esphome
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/** @file
+ * CRC functions, shared by the components for serial protocols.
+ *
+ * Each function checksums \p data with size \p len. To checksum data that arrives in pieces, pass the result of the
+ * previous call as \p crc, the default starts a new checksum.
+ */
+
+namespace esphome {
+
+/// Calculate a CRC-8 checksum (Dallas/Maxim 1-Wire, reflected polynomial 0x8C).
+uint8_t crc8(const uint8_t *data, size_t len, uint8_t crc = 0);
+/// Calculate a CRC-16 checksum (Modbus, reflected polynomial 0xA001). Start with \p crc 0 for CRC-16/ARC.
+uint16_t crc16(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
+/// Calculate a CRC-16 CCITT checksum (polynomial 0x1021, not reflected). Start with \p crc 0 for CRC-16/XMODEM.
+uint16_t crc16_ccitt(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
+/// Calculate a CRC-32 checksum (as used by zlib, Ethernet and PNG).
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0);
+
+}  // namespace esphome
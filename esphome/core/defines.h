@@ -15,6 +15,7 @@
 
 // Feature flags
 #define USE_API
+#define USE_API_BINARY_LOGS
 #define USE_API_NOISE
 #define USE_API_PLAINTEXT
 #define USE_BINARY_SENSOR
@@ -28,6 +29,7 @@
 #define USE_LIGHT
 #define USE_LOCK
 #define USE_LOGGER
+#define USE_LOOP_TIME_STATS
 #define USE_MDNS
 #define USE_MEDIA_PLAYER
 #define USE_MQTT
@@ -71,6 +73,7 @@
 #define USE_ESP32_IGNORE_EFUSE_MAC_CRC
 #define USE_IMPROV
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #define USE_WIFI_11KV_SUPPORT
 #define USE_BLUETOOTH_PROXY
 
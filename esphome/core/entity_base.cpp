@@ -5,14 +5,32 @@ namespace esphome {
 
 static const char *const TAG = "entity_base";
 
-EntityBase::EntityBase(std::string name) : name_(std::move(name)) { this->calc_object_id_(); }
+EntityBase::EntityBase(std::string name) {
+  if (!name.empty())
+    this->set_name(name);
+}
+
+EntityBase::RuntimeStrings *EntityBase::get_runtime_strings_() {
+  if (this->runtime_strings_ == nullptr)
+    this->runtime_strings_ = make_unique<RuntimeStrings>();
+  return this->runtime_strings_.get();
+}
 
 // Entity Name
-const std::string &EntityBase::get_name() const { return this->name_; }
+const StringRef &EntityBase::get_name() const { return this->name_; }
 void EntityBase::set_name(const std::string &name) {
-  this->name_ = name;
+  this->get_runtime_strings_()->name = name;
+  this->name_ = StringRef(this->runtime_strings_->name);
   this->calc_object_id_();
 }
+void EntityBase::set_name(const char *name, const char *object_id, uint32_t object_id_hash) {
+  // Free the copies of a name set before, unless the icon was copied there too
+  if (this->runtime_strings_ != nullptr && this->runtime_strings_->icon.empty())
+    this->runtime_strings_.reset();
+  this->name_ = StringRef(name);
+  this->object_id_ = StringRef(object_id);
+  this->object_id_hash_ = object_id_hash;
+}
 
 // Entity Internal
 bool EntityBase::is_internal() const { return this->internal_; }
@@ -23,21 +41,27 @@ bool EntityBase::is_disabled_by_default() const { return this->disabled_by_defau
 void EntityBase::set_disabled_by_default(bool disabled_by_default) { this->disabled_by_default_ = disabled_by_default; }
 
 // Entity Icon
-const std::string &EntityBase::get_icon() const { return this->icon_; }
-void EntityBase::set_icon(const std::string &name) { this->icon_ = name; }
+const StringRef &EntityBase::get_icon() const { return this->icon_; }
+void EntityBase::set_icon(const std::string &icon) {
+  this->get_runtime_strings_()->icon = icon;
+  this->icon_ = StringRef(this->runtime_strings_->icon);
+}
+void EntityBase::set_icon(const char *icon) { this->icon_ = StringRef(icon); }
 
 // Entity Category
 EntityCategory EntityBase::get_entity_category() const { return this->entity_category_; }
 void EntityBase::set_entity_category(EntityCategory entity_category) { this->entity_category_ = entity_category; }
 
 // Entity Object ID
-const std::string &EntityBase::get_object_id() { return this->object_id_; }
+const StringRef &EntityBase::get_object_id() { return this->object_id_; }
 
-// Calculate Object ID Hash from Entity Name
+// Calculate Object ID Hash from a name set at runtime
 void EntityBase::calc_object_id_() {
-  this->object_id_ = str_sanitize(str_snake_case(this->name_));
+  RuntimeStrings *strings = this->get_runtime_strings_();
+  strings->object_id = str_sanitize(str_snake_case(strings->name));
+  this->object_id_ = StringRef(strings->object_id);
   // FNV-1 hash
-  this->object_id_hash_ = fnv1_hash(this->object_id_);
+  this->object_id_hash_ = fnv1_hash(strings->object_id);
 }
 uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
 
@@ -2,6 +2,8 @@
 
 #include <string>
 #include <cstdint>
+#include <memory>
+#include "esphome/core/string_ref.h"
 
 namespace esphome {
 
@@ -14,15 +16,18 @@ enum EntityCategory : uint8_t {
 // The generic Entity base class that provides an interface common to all Entities.
 class EntityBase {
  public:
-  EntityBase() : EntityBase("") {}
+  EntityBase() = default;
   explicit EntityBase(std::string name);
 
   // Get/set the name of this Entity
-  const std::string &get_name() const;
+  const StringRef &get_name() const;
   void set_name(const std::string &name);
+  // Set the name together with the object ID and its hash, computed by codegen. Only for the string literals from
+  // codegen, the pointers are kept and the strings are not copied.
+  void set_name(const char *name, const char *object_id, uint32_t object_id_hash);
 
-  // Get the sanitized name of this Entity as an ID. Caching it internally.
-  const std::string &get_object_id();
+  // Get the sanitized name of this Entity as an ID.
+  const StringRef &get_object_id();
 
   // Get the unique Object ID of this Entity
   uint32_t get_object_id_hash();
@@ -41,9 +46,12 @@ class EntityBase {
   EntityCategory get_entity_category() const;
   void set_entity_category(EntityCategory entity_category);
 
-  // Get/set this entity's icon
-  const std::string &get_icon() const;
-  void set_icon(const std::string &name);
+  // Get/set this entity's icon. The std::string overload copies the icon.
+  const StringRef &get_icon() const;
+  void set_icon(const std::string &icon);
+  // Only for the string literals from codegen, the pointer is kept and the icon is not copied. Use the std::string
+  // overload for anything else.
+  void set_icon(const char *icon);
 
  protected:
   /// The hash_base() function has been deprecated. It is kept in this
@@ -51,10 +59,19 @@ class EntityBase {
   virtual uint32_t hash_base() { return 0L; }
   void calc_object_id_();
 
-  std::string name_;
-  std::string object_id_;
-  std::string icon_;
-  uint32_t object_id_hash_;
+  /// Storage for the strings set at runtime, the strings from codegen are referenced in place.
+  struct RuntimeStrings {
+    std::string name;
+    std::string object_id;
+    std::string icon;
+  };
+  RuntimeStrings *get_runtime_strings_();
+
+  StringRef name_;
+  StringRef object_id_;
+  StringRef icon_;
+  std::unique_ptr<RuntimeStrings> runtime_strings_;
+  uint32_t object_id_hash_{2166136261UL};  // fnv1_hash("")
   bool internal_{false};
   bool disabled_by_default_{false};
   EntityCategory entity_category_{ENTITY_CATEGORY_NONE};
@@ -49,41 +49,20 @@ std::string to_string(long double value) { return str_snprintf("%Lf", 32, value)
 // Mathematics
 
 float lerp(float completion, float start, float end) { return start + (end - start) * completion; }
-uint8_t crc8(uint8_t *data, uint8_t len) {
-  uint8_t crc = 0;
-
-  while ((len--) != 0u) {
-    uint8_t inbyte = *data++;
-    for (uint8_t i = 8; i != 0u; i--) {
-      bool mix = (crc ^ inbyte) & 0x01;
-      crc >>= 1;
-      if (mix)
-        crc ^= 0x8C;
-      inbyte >>= 1;
-    }
-  }
-  return crc;
-}
-uint16_t crc16(const uint8_t *data, uint8_t len) {
-  uint16_t crc = 0xFFFF;
-  while (len--) {
-    crc ^= *data++;
-    for (uint8_t i = 0; i < 8; i++) {
-      if ((crc & 0x01) != 0) {
-        crc >>= 1;
-        crc ^= 0xA001;
-      } else {
-        crc >>= 1;
-      }
-    }
+uint32_t fnv1_hash(const std::string &str) { return fnv1_hash(str.c_str(), str.size()); }
+uint32_t fnv1_hash(const char *str, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash *= 16777619UL;
+    hash ^= str[i];
   }
-  return crc;
+  return hash;
 }
-uint32_t fnv1_hash(const std::string &str) {
+uint32_t fnv1_hash(const char *str) {
   uint32_t hash = 2166136261UL;
-  for (char c : str) {
+  for (; *str != '\0'; str++) {
     hash *= 16777619UL;
-    hash ^= c;
+    hash ^= *str;
   }
   return hash;
 }
@@ -8,6 +8,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "esphome/core/crc.h"
 #include "esphome/core/optional.h"
 
 #ifdef USE_ESP32
@@ -146,14 +147,12 @@ template<typename T, typename U> T remap(U value, U min, U max, T min_out, T max
   return (value - min) * (max_out - min_out) / (max - min) + min_out;
 }
 
-/// Calculate a CRC-8 checksum of \p data with size \p len.
-uint8_t crc8(uint8_t *data, uint8_t len);
-
-/// Calculate a CRC-16 checksum of \p data with size \p len.
-uint16_t crc16(const uint8_t *data, uint8_t len);
-
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const std::string &str);
+/// Calculate a FNV-1 hash of the first \p len characters of \p str.
+uint32_t fnv1_hash(const char *str, size_t len);
+/// Calculate a FNV-1 hash of the null-terminated string \p str.
+uint32_t fnv1_hash(const char *str);
 
 /// Return a random 32-bit unsigned integer.
 uint32_t random_uint32();
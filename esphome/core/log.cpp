@@ -8,6 +8,8 @@
 
 namespace esphome {
 
+int esp_log_level_max_ = ESPHOME_LOG_LEVEL;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 void HOT esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {  // NOLINT
   va_list arg;
   va_start(arg, format);
@@ -53,7 +55,7 @@ int HOT esp_idf_log_vprintf_(const char *format, va_list args) {  // NOLINT
   if (log == nullptr)
     return 0;
 
-  log->log_vprintf_(ESPHOME_LOG_LEVEL, "esp-idf", 0, format, args);
+  log->log_vprintf_(log->level_for("esp-idf"), "esp-idf", 0, format, args);
 #endif
   return 0;
 }
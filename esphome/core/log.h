@@ -63,15 +63,26 @@ void esp_log_vprintf_(int level, const char *tag, int line, const __FlashStringH
 int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 #endif
 
+/// Highest level any tag is currently logged at, kept up to date by the logger. Defaults to ESPHOME_LOG_LEVEL.
+extern int esp_log_level_max_;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 #define ESPHOME_LOG_FORMAT(format) F(format)
 #else
 #define ESPHOME_LOG_FORMAT(format) format
 #endif
 
+// Messages above the highest level enabled at runtime for any tag are dropped right at the call site with a single
+// compare, so filtered-out log calls don't pay for argument passing or the per-tag level lookup in the logger.
+#define ESPHOME_LOG_IF_ENABLED_(level, tag, format, ...) \
+  do { \
+    if ((level) <= ::esphome::esp_log_level_max_) \
+      esp_log_printf_(level, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__); \
+  } while (0)
+
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERY_VERBOSE
 #define esph_log_vv(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_VERY_VERBOSE
 #else
@@ -80,7 +91,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
 #define esph_log_v(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_VERBOSE, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_VERBOSE, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_VERBOSE
 #else
@@ -89,9 +100,9 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
 #define esph_log_d(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_DEBUG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_DEBUG, tag, format, ##__VA_ARGS__)
 #define esph_log_config(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_CONFIG, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_CONFIG, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_DEBUG
 #define ESPHOME_LOG_HAS_CONFIG
@@ -102,7 +113,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO
 #define esph_log_i(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_INFO, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_INFO, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_INFO
 #else
@@ -111,7 +122,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_WARN
 #define esph_log_w(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_WARN, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_WARN, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_WARN
 #else
@@ -120,7 +131,7 @@ int esp_idf_log_vprintf_(const char *format, va_list args);  // NOLINT
 
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR
 #define esph_log_e(tag, format, ...) \
-  esp_log_printf_(ESPHOME_LOG_LEVEL_ERROR, tag, __LINE__, ESPHOME_LOG_FORMAT(format), ##__VA_ARGS__)
+  ESPHOME_LOG_IF_ENABLED_(ESPHOME_LOG_LEVEL_ERROR, tag, format, ##__VA_ARGS__)
 
 #define ESPHOME_LOG_HAS_ERROR
 #else
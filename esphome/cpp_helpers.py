@@ -12,15 +12,18 @@ from esphome.const import (
 )
 
 # pylint: disable=unused-import
-from esphome.core import coroutine, ID, CORE
+from esphome.core import coroutine, coroutine_with_priority, ID, CORE
 from esphome.types import ConfigType, ConfigFragmentType
-from esphome.cpp_generator import add, get_variable
-from esphome.cpp_types import App
+from esphome.cpp_generator import add, get_variable, static_const_array
+from esphome.cpp_types import App, uint16
+from esphome.helpers import fnv1_hash, sanitize, snake_case
 from esphome.util import Registry, RegistryEntry
 
 
 _LOGGER = logging.getLogger(__name__)
 
+KEY_ENTITY_KEYS = "entity_keys"
+
 
 async def gpio_pin_expression(conf):
     """Generate an expression for the given pin option.
@@ -95,9 +98,41 @@ async def register_parented(var, value):
     add(var.set_parent(paren))
 
 
+def entity_object_id(config):
+    """Return the object id of an entity, the same as EntityBase::calc_object_id_() computes at runtime"""
+    return sanitize(snake_case(config[CONF_NAME]))
+
+
+@coroutine_with_priority(-1000.0)
+async def _add_entity_key_orders():
+    # Runs after all entities are registered
+    for domain, keys in CORE.data[KEY_ENTITY_KEYS].items():
+        # sorted() is stable, so entities with the same key keep their registration order
+        order = sorted(range(len(keys)), key=keys.__getitem__)
+        arr = static_const_array(
+            ID(f"{domain}_key_order", is_declaration=True, type=uint16), order
+        )
+        add(getattr(App, f"set_{domain}_key_order")(arr, len(order)))
+
+
+def register_entity_key(domain, config):
+    """Record the key of an entity that is registered with App.register_<domain>().
+
+    Must be called in the same order as the register calls. At the end of code generation
+    the registration indices are emitted sorted by key, so Application can look up entities
+    by key with a binary search.
+    """
+    entity_keys = CORE.data.setdefault(KEY_ENTITY_KEYS, {})
+    if not entity_keys:
+        CORE.add_job(_add_entity_key_orders)
+    entity_keys.setdefault(domain, []).append(fnv1_hash(entity_object_id(config)))
+
+
 async def setup_entity(var, config):
     """Set up generic properties of an Entity"""
-    add(var.set_name(config[CONF_NAME]))
+    # The object id and its hash are computed here, so the entity only references the literals
+    object_id = entity_object_id(config)
+    add(var.set_name(config[CONF_NAME], object_id, fnv1_hash(object_id)))
     add(var.set_disabled_by_default(config[CONF_DISABLED_BY_DEFAULT]))
     if CONF_INTERNAL in config:
         add(var.set_internal(config[CONF_INTERNAL]))
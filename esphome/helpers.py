@@ -3,6 +3,8 @@ from contextlib import suppress
 
 import logging
 import os
+import re
+import string
 from pathlib import Path
 from typing import Union
 import tempfile
@@ -59,6 +61,29 @@ def cpp_string_escape(string, encoding="utf-8"):
     return f'"{result}"'
 
 
+_ASCII_LOWER = str.maketrans(string.ascii_uppercase, string.ascii_lowercase)
+_DISALLOWED_CHARS = re.compile(r"[^-_0-9a-zA-Z]")
+
+
+def snake_case(value):
+    """Same behaviour as `helpers.cpp` method `str_snake_case`."""
+    return value.translate(_ASCII_LOWER).replace(" ", "_")
+
+
+def sanitize(value):
+    """Same behaviour as `helpers.cpp` method `str_sanitize`."""
+    return _DISALLOWED_CHARS.sub("", value)
+
+
+def fnv1_hash(value):
+    """Same behaviour as `helpers.h` method `fnv1_hash` for ASCII strings."""
+    hash_ = 2166136261
+    for char in value.encode("utf-8"):
+        hash_ = (hash_ * 16777619) & 0xFFFFFFFF
+        hash_ ^= char
+    return hash_
+
+
 def run_system_command(*args):
     import subprocess
 
@@ -45,7 +45,7 @@ def indent_list(text, padding="  "):
     for line in text.splitlines():
         if line == "":
             p = ""
-        elif line.startswith("#ifdef") or line.startswith("#endif"):
+        elif line.startswith(("#if", "#else", "#endif")):
             p = ""
         else:
             p = padding
@@ -181,6 +181,13 @@ class TypeInfo:
 
     encode_func = None
 
+    def table_content(self, class_name):
+        if self.table_type is None:
+            return None
+        return f"{{offsetof({class_name}, {self.field_name}), {self.number}, {self.table_type}, nullptr}},"
+
+    table_type = None
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -217,6 +224,7 @@ class DoubleType(TypeInfo):
 
 @register_type(2)
 class FloatType(TypeInfo):
+    table_type = "PROTO_FIELD_FLOAT"
     cpp_type = "float"
     default_value = "0.0f"
     decode_32bit = "value.as_float()"
@@ -230,6 +238,7 @@ class FloatType(TypeInfo):
 
 @register_type(3)
 class Int64Type(TypeInfo):
+    table_type = "PROTO_FIELD_INT64"
     cpp_type = "int64_t"
     default_value = "0"
     decode_varint = "value.as_int64()"
@@ -243,6 +252,7 @@ class Int64Type(TypeInfo):
 
 @register_type(4)
 class UInt64Type(TypeInfo):
+    table_type = "PROTO_FIELD_UINT64"
     cpp_type = "uint64_t"
     default_value = "0"
     decode_varint = "value.as_uint64()"
@@ -256,6 +266,7 @@ class UInt64Type(TypeInfo):
 
 @register_type(5)
 class Int32Type(TypeInfo):
+    table_type = "PROTO_FIELD_INT32"
     cpp_type = "int32_t"
     default_value = "0"
     decode_varint = "value.as_int32()"
@@ -269,6 +280,7 @@ class Int32Type(TypeInfo):
 
 @register_type(6)
 class Fixed64Type(TypeInfo):
+    table_type = "PROTO_FIELD_FIXED64"
     cpp_type = "uint64_t"
     default_value = "0"
     decode_64bit = "value.as_fixed64()"
@@ -282,6 +294,7 @@ class Fixed64Type(TypeInfo):
 
 @register_type(7)
 class Fixed32Type(TypeInfo):
+    table_type = "PROTO_FIELD_FIXED32"
     cpp_type = "uint32_t"
     default_value = "0"
     decode_32bit = "value.as_fixed32()"
@@ -295,6 +308,7 @@ class Fixed32Type(TypeInfo):
 
 @register_type(8)
 class BoolType(TypeInfo):
+    table_type = "PROTO_FIELD_BOOL"
     cpp_type = "bool"
     default_value = "false"
     decode_varint = "value.as_bool()"
@@ -307,6 +321,7 @@ class BoolType(TypeInfo):
 
 @register_type(9)
 class StringType(TypeInfo):
+    table_type = "PROTO_FIELD_STRING"
     cpp_type = "std::string"
     default_value = ""
     reference_type = "std::string &"
@@ -321,6 +336,7 @@ class StringType(TypeInfo):
 
 @register_type(11)
 class MessageType(TypeInfo):
+    table_type = "PROTO_FIELD_MESSAGE"
     @property
     def cpp_type(self):
         return self._field.type_name[1:]
@@ -350,6 +366,7 @@ class MessageType(TypeInfo):
 
 @register_type(12)
 class BytesType(TypeInfo):
+    table_type = "PROTO_FIELD_STRING"
     cpp_type = "std::string"
     default_value = ""
     reference_type = "std::string &"
@@ -364,6 +381,7 @@ class BytesType(TypeInfo):
 
 @register_type(13)
 class UInt32Type(TypeInfo):
+    table_type = "PROTO_FIELD_UINT32"
     cpp_type = "uint32_t"
     default_value = "0"
     decode_varint = "value.as_uint32()"
@@ -377,6 +395,7 @@ class UInt32Type(TypeInfo):
 
 @register_type(14)
 class EnumType(TypeInfo):
+    table_type = "PROTO_FIELD_ENUM"
     @property
     def cpp_type(self):
         return f"enums::{self._field.type_name[1:]}"
@@ -424,6 +443,7 @@ class SFixed64Type(TypeInfo):
 
 @register_type(17)
 class SInt32Type(TypeInfo):
+    table_type = "PROTO_FIELD_SINT32"
     cpp_type = "int32_t"
     default_value = "0"
     decode_varint = "value.as_sint32()"
@@ -437,6 +457,7 @@ class SInt32Type(TypeInfo):
 
 @register_type(18)
 class SInt64Type(TypeInfo):
+    table_type = "PROTO_FIELD_SINT64"
     cpp_type = "int64_t"
     default_value = "0"
     decode_varint = "value.as_sint64()"
@@ -529,6 +550,15 @@ class RepeatedTypeInfo(TypeInfo):
         o += f"}}"
         return o
 
+    def table_content(self, class_name):
+        if self._ti.table_type is None:
+            return None
+        if self._ti_is_bool:
+            # std::vector<bool> can't hand out element pointers and is handled separately
+            return f"{{offsetof({class_name}, {self.field_name}), {self.number}, PROTO_FIELD_REPEATED_BOOL, nullptr}},"
+        ops = f"&ProtoRepeated<{self._ti.cpp_type}>::OPS"
+        return f"{{offsetof({class_name}, {self.field_name}), {self.number}, {self._ti.table_type}, {ops}}},"
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -568,6 +598,8 @@ def build_message_type(desc):
     decode_64bit = []
     encode = []
     dump = []
+    table = []
+    table_ids = []
 
     for field in desc.field:
         if field.label == 3:
@@ -577,6 +609,12 @@ def build_message_type(desc):
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        table_entry = ti.table_content(desc.name)
+        if table_entry is None:
+            raise ValueError(f"{desc.name}.{field.name} is not supported by the table codec")
+        assert field.number < 256, "Field ids of the table codec must fit in a byte"
+        table.append(table_entry)
+        table_ids.append(field.number)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -589,7 +627,46 @@ def build_message_type(desc):
         if ti.dump_content:
             dump.append(ti.dump_content)
 
-    cpp = ""
+    cpp = "#ifdef USE_API_PROTO_TABLES\n"
+    table_name = f"{camel_to_snake(desc.name).upper()}_FIELDS"
+    index_name = f"{camel_to_snake(desc.name).upper()}_INDEX"
+    o = f"ProtoFieldTable {desc.name}::get_field_table() const {{"
+    if table:
+        # Position in the table + 1 by field id, so decoding finds a field without a search
+        index = [0] * (max(table_ids) + 1)
+        for pos, number in enumerate(table_ids):
+            index[number] = pos + 1
+        line = f"static const uint8_t {index_name}[] = {{{', '.join(map(str, index))}}};"
+        if len(line) > 120:
+            # Bin-pack the values after the brace, like clang-format does
+            line = f"static const uint8_t {index_name}[] = {{\n   "
+            width = 3
+            for i, value in enumerate(index):
+                item = f" {value}" + ("," if i + 1 < len(index) else "};")
+                if width + len(item) > 120:
+                    line += "\n   "
+                    width = 3
+                line += item
+                width += len(item)
+        cpp += line + "\n"
+        cpp += f"static const ProtoFieldInfo {table_name}[] = {{\n"
+        for entry in table:
+            line = f"    {entry}"
+            if len(line) > 120:
+                # Wrap before the repeated field accessor, like clang-format does
+                head, ops = line.rsplit(", ", 1)
+                line = f"{head},\n     {ops}"
+            cpp += line + "\n"
+        cpp += "};\n"
+        ret = f"return {{{table_name}, {len(table)}, {index_name}, {len(index)}}};"
+    else:
+        ret = "return {nullptr, 0, nullptr, 0};"
+    if len(o) + len(ret) + 3 < 120:
+        o += f" {ret} "
+    else:
+        o += f"\n  {ret}\n"
+    cpp += o + "}\n"
+    cpp += "#else\n"
     if decode_varint:
         decode_varint.append("default:\n  return false;")
         o = f"bool {desc.name}::decode_varint(uint32_t field_id, ProtoVarInt value) {{\n"
@@ -640,8 +717,16 @@ def build_message_type(desc):
             o += indent("\n".join(encode)) + "\n"
     o += "}\n"
     cpp += o
-    prot = "void encode(ProtoWriteBuffer buffer) const override;"
+    cpp += "#endif\n"
+    prot = "#ifdef USE_API_PROTO_TABLES\n"
+    prot += "ProtoFieldTable get_field_table() const override;\n"
+    prot += "#else\n"
+    prot += "void encode(ProtoWriteBuffer buffer) const override;\n"
+    prot += "#endif"
     public_content.append(prot)
+    if protected_content:
+        protected_content.insert(0, "#ifndef USE_API_PROTO_TABLES")
+        protected_content.append("#endif")
 
     o = f"void {desc.name}::dump_to(std::string &out) const {{"
     if dump:
@@ -698,6 +783,12 @@ cpp += """\
 #include "api_pb2.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_API_PROTO_TABLES
+#include <cstddef>
+// Messages are polymorphic, offsetof() on them is conditionally-supported but works with GCC and clang
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
 namespace esphome {
 namespace api {
 
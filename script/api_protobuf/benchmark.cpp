@@ -0,0 +1,141 @@
+// Host benchmark for the generated protobuf code, built by benchmark.py once per codec mode.
+#include "esphome/components/api/api_pb2.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+using namespace esphome::api;
+
+// Same as in api_pb2.cpp
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+
+// api.proto has no 64-bit fields yet, this message covers their encoding and decoding in both modes
+class Fixed64Message : public ProtoMessage {
+ public:
+  uint64_t value{0};
+#ifdef USE_API_PROTO_TABLES
+  ProtoFieldTable get_field_table() const override {
+    static const uint8_t INDEX[] = {0, 0, 1};
+    static const ProtoFieldInfo FIELDS[] = {{offsetof(Fixed64Message, value), 2, PROTO_FIELD_FIXED64, nullptr}};
+    return {FIELDS, 1, INDEX, 3};
+  }
+#else
+  void encode(ProtoWriteBuffer buffer) const override { buffer.encode_fixed64(2, this->value); }
+#endif
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override {}
+#endif
+
+ protected:
+#ifndef USE_API_PROTO_TABLES
+  bool decode_64bit(uint32_t field_id, Proto64Bit value) override {
+    if (field_id != 2)
+      return false;
+    this->value = value.as_fixed64();
+    return true;
+  }
+#endif
+};
+
+static uint32_t checksum = 2166136261UL;
+
+static void add_checksum(const std::vector<uint8_t> &data) {
+  for (uint8_t b : data) {
+    checksum ^= b;
+    checksum *= 16777619UL;
+  }
+}
+
+template<class C> static void bench(const char *name, const C &msg, int iterations) {
+  std::vector<uint8_t> encoded;
+  msg.encode(ProtoWriteBuffer{&encoded});
+  add_checksum(encoded);
+
+  // Decode and encode again to verify the round-trip
+  C decoded;
+  decoded.decode(encoded.data(), encoded.size());
+  std::vector<uint8_t> reencoded;
+  decoded.encode(ProtoWriteBuffer{&reencoded});
+  if (reencoded != encoded) {
+    printf("%s: round-trip mismatch\n", name);
+    exit(1);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    encoded.clear();
+    msg.encode(ProtoWriteBuffer{&encoded});
+  }
+  auto mid = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    C out;
+    out.decode(encoded.data(), encoded.size());
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double encode_ns = std::chrono::duration<double, std::nano>(mid - start).count() / iterations;
+  double decode_ns = std::chrono::duration<double, std::nano>(end - mid).count() / iterations;
+  printf("%-36s %4zu bytes  encode %8.1f ns  decode %8.1f ns\n", name, encoded.size(), encode_ns, decode_ns);
+}
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+
+  SensorStateResponse sensor;
+  sensor.key = 0x12345678;
+  sensor.state = 21.5f;
+  bench("SensorStateResponse", sensor, iterations);
+
+  LightStateResponse light;
+  light.key = 0xDEADBEEF;
+  light.state = true;
+  light.brightness = 0.5f;
+  light.color_mode = enums::COLOR_MODE_RGB;
+  light.red = 1.0f;
+  light.green = 0.25f;
+  light.effect = "rainbow";
+  bench("LightStateResponse", light, iterations);
+
+  ListEntitiesClimateResponse climate;
+  climate.object_id = "living_room";
+  climate.key = 0xCAFEBABE;
+  climate.name = "Living Room";
+  climate.unique_id = "livingroomclimate";
+  climate.supported_modes = {enums::CLIMATE_MODE_OFF, enums::CLIMATE_MODE_HEAT, enums::CLIMATE_MODE_COOL};
+  climate.visual_min_temperature = 16.0f;
+  climate.visual_max_temperature = 30.0f;
+  climate.visual_temperature_step = 0.5f;
+  climate.supported_custom_fan_modes = {"Turbo", "Quiet"};
+  climate.supported_presets = {enums::CLIMATE_PRESET_HOME, enums::CLIMATE_PRESET_AWAY};
+  climate.entity_category = enums::ENTITY_CATEGORY_CONFIG;
+  bench("ListEntitiesClimateResponse", climate, iterations);
+
+  HomeassistantServiceResponse service;
+  service.service = "light.turn_on";
+  for (int i = 0; i < 3; i++) {
+    HomeassistantServiceMap kv;
+    kv.key = "key" + std::to_string(i);
+    kv.value = "value" + std::to_string(i);
+    service.data.push_back(kv);
+  }
+  bench("HomeassistantServiceResponse", service, iterations);
+
+  ExecuteServiceRequest execute;
+  execute.key = 42;
+  ExecuteServiceArgument arg;
+  arg.int_ = -5;
+  arg.bool_array = {true, false, true};
+  arg.int_array = {1, -2, 3};
+  arg.float_array = {0.5f, -1.5f};
+  arg.string_array = {"a", "bc"};
+  execute.args.push_back(arg);
+  bench("ExecuteServiceRequest", execute, iterations);
+
+  Fixed64Message fixed64;
+  fixed64.value = 0x0123456789ABCDEFULL;
+  bench("Fixed64Message", fixed64, iterations);
+
+  printf("checksum %08x\n", checksum);
+  return 0;
+}
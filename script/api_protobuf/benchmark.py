@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Compare the switch-based and the table-driven (USE_API_PROTO_TABLES) protobuf codecs.
+
+Compiles proto.cpp and api_pb2.cpp in both modes and prints the code size of each.
+With the host compiler it also runs benchmark.cpp to compare encode/decode speed and to
+check that both modes produce the same bytes.
+
+    script/api_protobuf/benchmark.py
+    script/api_protobuf/benchmark.py --cxx xtensa-esp32-elf-g++ --size xtensa-esp32-elf-size --no-run
+"""
+
+import argparse
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+cwd = Path(__file__).resolve().parent
+root = cwd.parent.parent
+api = root / "esphome" / "components" / "api"
+
+MODES = {
+    "switch": [],
+    "table": ["-DUSE_API_PROTO_TABLES"],
+}
+
+
+def compile_object(args, source, output, flags):
+    cmd = [
+        args.cxx,
+        "-std=gnu++17",
+        *args.cflags.split(),
+        f"-I{root}",
+        "-DESPHOME_LOG_LEVEL=0",
+        *flags,
+        "-c",
+        str(source),
+        "-o",
+        str(output),
+    ]
+    subprocess.run(cmd, check=True)
+
+
+def object_size(args, objects):
+    out = subprocess.run(
+        [args.size, *map(str, objects)], check=True, capture_output=True, text=True
+    ).stdout
+    text = data = 0
+    for line in out.splitlines()[1:]:
+        parts = line.split()
+        text += int(parts[0])
+        data += int(parts[1])
+    return text, data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default="g++", help="C++ compiler to use")
+    parser.add_argument("--size", default="size", help="size tool matching the compiler")
+    parser.add_argument("--cflags", default="-Os", help="Optimization flags")
+    parser.add_argument(
+        "--no-run", action="store_true", help="Only report sizes (for cross compilers)"
+    )
+    parser.add_argument(
+        "--iterations", type=int, default=200000, help="Benchmark iterations"
+    )
+    args = parser.parse_args()
+
+    sizes = {}
+    checksums = {}
+    with tempfile.TemporaryDirectory() as tmp:
+        tmp = Path(tmp)
+        for mode, flags in MODES.items():
+            objects = []
+            for name in ("proto", "api_pb2"):
+                obj = tmp / f"{name}_{mode}.o"
+                compile_object(args, api / f"{name}.cpp", obj, flags)
+                objects.append(obj)
+            sizes[mode] = object_size(args, objects)
+
+            if args.no_run:
+                continue
+            bench = tmp / f"benchmark_{mode}.o"
+            compile_object(args, cwd / "benchmark.cpp", bench, flags)
+            binary = tmp / f"benchmark_{mode}"
+            subprocess.run(
+                [args.cxx, *map(str, objects), str(bench), "-o", str(binary)],
+                check=True,
+            )
+            print(f"== {mode}")
+            out = subprocess.run(
+                [str(binary), str(args.iterations)],
+                check=True,
+                capture_output=True,
+                text=True,
+            ).stdout
+            print(out, end="")
+            checksums[mode] = out.splitlines()[-1]
+
+    print("== size (proto.o + api_pb2.o)")
+    for mode, (text, data) in sizes.items():
+        print(f"{mode:<8} text {text:8}  data {data:8}")
+    text_diff = sizes["table"][0] - sizes["switch"][0]
+    print(f"table - switch: text {text_diff:+}")
+
+    if len(set(checksums.values())) > 1:
+        print("Encoded output differs between the modes!")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,123 @@
+// Host benchmark for the CRC functions, compares them with the bit at a time loops crc8() and crc16() used before.
+//
+//   g++ -O2 -std=gnu++11 -I. -o /tmp/crc_benchmark script/crc/benchmark.cpp esphome/core/crc.cpp
+//   /tmp/crc_benchmark [frame size] [iterations]
+#include "esphome/core/crc.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace esphome;
+
+// Bit at a time implementations of the same CRCs to verify the tables against
+static uint8_t bitwise_crc8(const uint8_t *data, size_t len, uint8_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc & 0x01) ? (crc >> 1) ^ 0x8C : crc >> 1;
+  }
+  return crc;
+}
+static uint16_t bitwise_crc16(const uint8_t *data, size_t len, uint16_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc & 0x0001) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+  }
+  return crc;
+}
+static uint16_t bitwise_crc16_ccitt(const uint8_t *data, size_t len, uint16_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= uint16_t(data[i]) << 8;
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+static uint32_t bitwise_crc32(const uint8_t *data, size_t len, uint32_t crc) {
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+  }
+  return ~crc;
+}
+
+template<typename T>
+static bool verify(const char *name, T (*table)(const uint8_t *, size_t, T), T (*bitwise)(const uint8_t *, size_t, T),
+                   T init, T check, const std::vector<uint8_t> &data) {
+  const uint8_t *digits = reinterpret_cast<const uint8_t *>("123456789");
+  if (table(digits, 9, init) != check || bitwise(digits, 9, init) != check) {
+    printf("Mismatch for %s check value\n", name);
+    return false;
+  }
+  for (size_t len = 0; len <= data.size(); len += 7) {
+    T expected = bitwise(data.data(), len, init);
+    // In one piece, and in two pieces continuing the checksum
+    if (table(data.data(), len, init) != expected || table(data.data() + len / 3, len - len / 3,
+                                                           table(data.data(), len / 3, init)) != expected) {
+      printf("Mismatch for %s over %zu bytes\n", name, len);
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+static void bench(const char *name, T (*table)(const uint8_t *, size_t, T), T (*bitwise)(const uint8_t *, size_t, T),
+                  T init, const std::vector<uint8_t> &data, int iterations) {
+  T bitwise_sum = 0, table_sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < iterations; n++)
+    bitwise_sum ^= bitwise(data.data(), data.size(), T(init + n));
+  auto mid = std::chrono::steady_clock::now();
+  for (int n = 0; n < iterations; n++)
+    table_sum ^= table(data.data(), data.size(), T(init + n));
+  auto end = std::chrono::steady_clock::now();
+
+  double bytes = double(iterations) * data.size();
+  printf("%-12s bitwise %6.2f ns/byte, table %6.2f ns/byte (%s)\n", name,
+         std::chrono::duration<double, std::nano>(mid - start).count() / bytes,
+         std::chrono::duration<double, std::nano>(end - mid).count() / bytes,
+         bitwise_sum == table_sum ? "same" : "DIFFERENT");
+}
+
+int main(int argc, char **argv) {
+  size_t size = argc > 1 ? atoi(argv[1]) : 256;
+  int iterations = argc > 2 ? atoi(argv[2]) : 100000;
+
+  std::vector<uint8_t> data(size);
+  uint32_t seed = 12345;
+  for (auto &b : data) {
+    seed = seed * 1103515245 + 12345;
+    b = seed >> 16;
+  }
+
+  if (!verify<uint8_t>("crc8", crc8, bitwise_crc8, 0, 0xA1, data) ||
+      !verify<uint16_t>("crc16", crc16, bitwise_crc16, 0xFFFF, 0x4B37, data) ||
+      !verify<uint16_t>("crc16 arc", crc16, bitwise_crc16, 0, 0xBB3D, data) ||
+      !verify<uint16_t>("crc16_ccitt", crc16_ccitt, bitwise_crc16_ccitt, 0xFFFF, 0x29B1, data) ||
+      !verify<uint16_t>("xmodem", crc16_ccitt, bitwise_crc16_ccitt, 0, 0x31C3, data) ||
+      !verify<uint32_t>("crc32", crc32, bitwise_crc32, 0, 0xCBF43926, data))
+    return 1;
+
+  // A Modbus frame followed by its CRC checks as zero, which the receiver relies on
+  std::vector<uint8_t> frame = {0x01, 0x03, 0x04, 0x00, 0x64, 0x00, 0xC8};
+  uint16_t crc = crc16(frame.data(), frame.size());
+  frame.push_back(crc >> 0);
+  frame.push_back(crc >> 8);
+  if (crc16(frame.data(), frame.size()) != 0) {
+    printf("Mismatch for the Modbus residue\n");
+    return 1;
+  }
+
+  printf("%zu byte frames\n", size);
+  bench<uint8_t>("crc8", crc8, bitwise_crc8, 0, data, iterations);
+  bench<uint16_t>("crc16", crc16, bitwise_crc16, 0xFFFF, data, iterations);
+  bench<uint16_t>("crc16_ccitt", crc16_ccitt, bitwise_crc16_ccitt, 0xFFFF, data, iterations);
+  bench<uint32_t>("crc32", crc32, bitwise_crc32, 0, data, iterations);
+  return 0;
+}
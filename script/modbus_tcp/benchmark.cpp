@@ -0,0 +1,238 @@
+// Host benchmark for the Modbus TCP transport, polls devices behind a simulated Modbus TCP gateway with one request at
+// a time, as on a serial bus, and with concurrent transactions. The gateway answers the units with different delays,
+// so the responses arrive out of order and each device checks that it got the registers it asked for.
+//
+//   g++ -O2 -std=gnu++11 -pthread -include limits -I. -DUSE_SOCKET_IMPL_BSD_SOCKETS -include netinet/in.h
+//       -include netinet/tcp.h -include arpa/inet.h -o /tmp/modbus_tcp_benchmark script/modbus_tcp/benchmark.cpp
+//       esphome/components/modbus_tcp/modbus_tcp.cpp esphome/components/modbus_base/modbus_base.cpp
+//       esphome/components/socket/bsd_sockets_impl.cpp esphome/components/socket/socket.cpp
+//   /tmp/modbus_tcp_benchmark [devices] [reads per device] [latency us]
+#include "esphome/components/modbus_tcp/modbus_tcp.h"
+
+#include <poll.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace esphome;
+
+// The transport only needs a few symbols of the core and of the network component, define them here so the benchmark
+// links without the rest of the framework
+static const auto START = std::chrono::steady_clock::now();
+namespace esphome {
+uint32_t millis() {
+  // Start late enough that the first connection attempt isn't held back by the reconnect interval
+  auto elapsed = std::chrono::steady_clock::now() - START;
+  return 10000 + std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+uint32_t micros() { return millis() * 1000; }
+namespace setup_priority {
+const float BUS = 1000.0f;
+const float AFTER_WIFI = 200.0f;
+}  // namespace setup_priority
+void Component::setup() {}
+void Component::loop() {}
+void Component::dump_config() {}
+float Component::get_setup_priority() const { return 0.0f; }
+float Component::get_loop_priority() const { return 0.0f; }
+void Component::mark_failed() {}
+bool Component::can_proceed() { return true; }
+void Component::call_loop() {}
+void Component::call_setup() {}
+void Component::call_dump_config() {}
+void HighFrequencyLoopRequester::start() {}
+void HighFrequencyLoopRequester::stop() {}
+void esp_log_printf_(int level, const char *tag, int line, const char *format, ...) {}
+std::string format_hex_pretty(const uint8_t *data, size_t length) { return ""; }
+namespace network {
+bool is_connected() { return true; }
+}  // namespace network
+}  // namespace esphome
+
+static uint16_t register_value(uint8_t unit, uint16_t address) { return uint16_t(address * 7 + unit * 1000); }
+
+// Answers read holding registers requests of any unit, units with a higher id take longer
+class Simulator {
+ public:
+  Simulator(uint32_t latency_us) : latency_us_(latency_us) {
+    this->listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    int enable = 1;
+    ::setsockopt(this->listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ::bind(this->listen_fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
+    socklen_t len = sizeof(addr);
+    ::getsockname(this->listen_fd_, reinterpret_cast<struct sockaddr *>(&addr), &len);
+    this->port_ = ntohs(addr.sin_port);
+    ::listen(this->listen_fd_, 1);
+    this->thread_ = std::thread([this]() { this->run_(); });
+  }
+  ~Simulator() {
+    this->stop_ = true;
+    this->thread_.join();
+    ::close(this->listen_fd_);
+  }
+  uint16_t port() const { return this->port_; }
+  size_t max_in_flight() const { return this->max_in_flight_; }
+
+ protected:
+  struct Response {
+    std::chrono::steady_clock::time_point due;
+    std::vector<uint8_t> frame;
+  };
+
+  void run_() {
+    while (!this->stop_) {
+      struct pollfd pfd = {this->listen_fd_, POLLIN, 0};
+      if (::poll(&pfd, 1, 10) <= 0)
+        continue;
+      int fd = ::accept(this->listen_fd_, nullptr, nullptr);
+      int enable = 1;
+      ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+      this->serve_(fd);
+      ::close(fd);
+    }
+  }
+
+  void serve_(int fd) {
+    std::vector<uint8_t> rx;
+    std::vector<Response> responses;
+    while (!this->stop_) {
+      auto now = std::chrono::steady_clock::now();
+      int timeout = 10;
+      for (auto &response : responses) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(response.due - now).count();
+        timeout = std::max(0, std::min(timeout, int(left)));
+      }
+      struct pollfd pfd = {fd, POLLIN, 0};
+      if (::poll(&pfd, 1, timeout) > 0) {
+        uint8_t buf[512];
+        ssize_t received = ::read(fd, buf, sizeof(buf));
+        if (received <= 0)
+          return;
+        rx.insert(rx.end(), buf, buf + received);
+      }
+      while (rx.size() >= 12) {
+        // MBAP header, unit 0x03 start count
+        size_t len = 6 + ((rx[4] << 8) | rx[5]);
+        if (rx.size() < len)
+          break;
+        uint8_t unit = rx[6];
+        uint16_t start = (rx[8] << 8) | rx[9];
+        uint16_t count = (rx[10] << 8) | rx[11];
+        std::vector<uint8_t> frame = {rx[0], rx[1], 0, 0, 0, uint8_t(3 + count * 2), unit, 0x03, uint8_t(count * 2)};
+        for (uint16_t i = 0; i < count; i++) {
+          uint16_t value = register_value(unit, start + i);
+          frame.push_back(value >> 8);
+          frame.push_back(value >> 0);
+        }
+        uint32_t delay = this->latency_us_ + this->latency_us_ * (unit % 4) / 2;
+        responses.push_back(Response{std::chrono::steady_clock::now() + std::chrono::microseconds(delay), frame});
+        this->max_in_flight_ = std::max(this->max_in_flight_.load(), responses.size());
+        rx.erase(rx.begin(), rx.begin() + len);
+      }
+      now = std::chrono::steady_clock::now();
+      for (auto it = responses.begin(); it != responses.end();) {
+        if (it->due <= now) {
+          ::write(fd, it->frame.data(), it->frame.size());
+          it = responses.erase(it);
+        } else {
+          it++;
+        }
+      }
+    }
+  }
+
+  uint32_t latency_us_;
+  int listen_fd_;
+  uint16_t port_;
+  std::atomic<bool> stop_{false};
+  std::atomic<size_t> max_in_flight_{0};
+  std::thread thread_;
+};
+
+// Reads blocks of 10 holding registers one after the other, like a modbus_controller with that many ranges
+class PollingDevice : public modbus::ModbusDevice {
+ public:
+  PollingDevice(uint8_t address, int reads) : reads_(reads) { this->set_address(address); }
+  bool send_next_command(bool writes_only) override {
+    if (writes_only || this->sent_ == this->reads_)
+      return false;
+    this->start_ = uint16_t(this->sent_ * 10);
+    this->send(0x03, this->start_, 10);
+    this->sent_++;
+    return true;
+  }
+  bool has_pending_commands() override { return this->sent_ < this->reads_; }
+  void on_modbus_data(const std::vector<uint8_t> &data) override {
+    bool ok = data.size() == 20;
+    for (size_t i = 0; ok && i < 10; i++)
+      ok = ((data[i * 2] << 8) | data[i * 2 + 1]) == register_value(this->address_, this->start_ + i);
+    if (!ok)
+      this->errors_++;
+    this->received_++;
+  }
+  bool done() const { return this->received_ == this->reads_; }
+  int errors() const { return this->errors_; }
+
+ protected:
+  int reads_;
+  int sent_{0};
+  int received_{0};
+  int errors_{0};
+  uint16_t start_{0};
+};
+
+static bool poll_all(const char *name, int devices, int reads, uint32_t latency_us, uint8_t max_outstanding) {
+  Simulator simulator(latency_us);
+  modbus_tcp::ModbusTCP transport;
+  transport.set_host(network::IPAddress(127, 0, 0, 1));
+  transport.set_port(simulator.port());
+  transport.set_max_outstanding_requests(max_outstanding);
+  std::vector<PollingDevice *> pollers;
+  for (int i = 0; i < devices; i++) {
+    auto *device = new PollingDevice(i + 1, reads);
+    device->set_parent(&transport);
+    transport.register_device(device);
+    pollers.push_back(device);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  bool done = false;
+  while (!done && std::chrono::steady_clock::now() - start < std::chrono::seconds(60)) {
+    transport.loop();
+    done = true;
+    for (auto *device : pollers)
+      done = done && device->done();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  int errors = 0;
+  for (auto *device : pollers) {
+    errors += device->errors();
+    delete device;
+  }
+  if (!done || errors != 0) {
+    printf("%s: %s, %d wrong responses\n", name, done ? "done" : "timed out", errors);
+    return false;
+  }
+  printf("%-12s %8.1f ms for %d reads, %zu requests in flight at most\n", name,
+         std::chrono::duration<double, std::milli>(end - start).count(), devices * reads, simulator.max_in_flight());
+  return true;
+}
+
+int main(int argc, char **argv) {
+  int devices = argc > 1 ? atoi(argv[1]) : 8;
+  int reads = argc > 2 ? atoi(argv[2]) : 20;
+  uint32_t latency_us = argc > 3 ? atoi(argv[3]) : 2000;
+
+  printf("%d devices, %d reads each, %u us latency\n", devices, reads, latency_us);
+  if (!poll_all("one at once", devices, reads, latency_us, 1) ||
+      !poll_all("concurrent", devices, reads, latency_us, uint8_t(std::min(devices, 64))))
+    return 1;
+  return 0;
+}
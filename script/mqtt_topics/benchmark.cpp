@@ -0,0 +1,151 @@
+// Host benchmark for the MQTT subscription dispatch, compares the TopicTrie with matching every subscription.
+//
+//   g++ -O2 -std=gnu++11 -I. -o /tmp/mqtt_topics_benchmark script/mqtt_topics/benchmark.cpp
+//       esphome/components/mqtt/mqtt_topic_trie.cpp
+//   /tmp/mqtt_topics_benchmark [entities] [iterations]
+#include "esphome/components/mqtt/mqtt_topic_trie.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using esphome::mqtt::TopicTrie;
+
+// The matcher MQTTClientComponent::on_message used before, called for every subscription
+static bool linear_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
+  if (*message == '\0' && *subscription == '\0')
+    return true;
+  if (*message == '\0' || *subscription == '\0')
+    return false;
+  bool do_wildcards = is_normal || past_separator;
+  if (*subscription == '+' && do_wildcards) {
+    subscription++;
+    while (*message != '\0' && *message != '/')
+      message++;
+    return linear_match(message, subscription, is_normal, true);
+  }
+  if (*subscription == '#' && do_wildcards)
+    return true;
+  if (*message != *subscription)
+    return false;
+  past_separator = past_separator || *subscription == '/';
+  return linear_match(message + 1, subscription + 1, is_normal, past_separator);
+}
+static bool linear_match(const std::string &message, const std::string &subscription) {
+  return linear_match(message.c_str(), subscription.c_str(), !message.empty() && message[0] != '$', false);
+}
+
+static std::vector<std::string> split_levels(const std::string &topic) {
+  std::vector<std::string> levels;
+  size_t start = 0;
+  while (true) {
+    size_t end = topic.find('/', start);
+    levels.push_back(topic.substr(start, end == std::string::npos ? std::string::npos : end - start));
+    if (end == std::string::npos)
+      return levels;
+    start = end + 1;
+  }
+}
+
+// Straightforward implementation of the MQTT 3.1.1 matching rules to verify the trie against
+static bool reference_match(const std::string &topic, const std::string &filter) {
+  std::vector<std::string> t = split_levels(topic);
+  std::vector<std::string> f = split_levels(filter);
+  bool sys = !topic.empty() && topic[0] == '$';
+  for (size_t i = 0; i < f.size(); i++) {
+    bool wildcards = i > 0 || !sys;
+    if (f[i] == "#")
+      return wildcards;
+    if (i >= t.size())
+      return false;
+    if (f[i] == "+" && wildcards)
+      continue;
+    if (f[i] != t[i])
+      return false;
+  }
+  return t.size() == f.size();
+}
+
+int main(int argc, char **argv) {
+  int entities = argc > 1 ? atoi(argv[1]) : 200;
+  int iterations = argc > 2 ? atoi(argv[2]) : 200;
+
+  // Command topics of a node with many entities, a few mqtt_subscribe sensors and wildcard subscriptions
+  static const char *const DOMAINS[] = {"switch", "light", "fan", "cover", "number", "select"};
+  std::vector<std::string> filters;
+  for (int i = 0; i < entities; i++)
+    filters.push_back("livingroom/" + std::string(DOMAINS[i % 6]) + "/entity_" + std::to_string(i) + "/command");
+  for (int i = 0; i < entities / 10; i++)
+    filters.push_back("home/sensors/room_" + std::to_string(i) + "/temperature");
+  filters.push_back("homeassistant/status");
+  filters.push_back("home/+/status");
+  filters.push_back("home/sensors/+/humidity");
+  filters.push_back("zigbee2mqtt/#");
+  filters.push_back("$SYS/broker/load/+");
+  filters.push_back("#");
+
+  std::vector<std::string> topics;
+  for (int i = 0; i < entities; i += 7)
+    topics.push_back("livingroom/" + std::string(DOMAINS[i % 6]) + "/entity_" + std::to_string(i) + "/command");
+  for (int i = 0; i < entities / 10; i++) {
+    topics.push_back("home/sensors/room_" + std::to_string(i) + "/temperature");
+    topics.push_back("home/sensors/room_" + std::to_string(i) + "/humidity");
+  }
+  topics.push_back("homeassistant/status");
+  topics.push_back("home/garage/status");
+  topics.push_back("zigbee2mqtt");
+  topics.push_back("zigbee2mqtt/bridge/state");
+  topics.push_back("$SYS/broker/load/bytes");
+  topics.push_back("livingroom/switch/unknown/command");
+  topics.push_back("livingroom/switch/entity_0/state");
+
+  TopicTrie trie;
+  for (size_t i = 0; i < filters.size(); i++)
+    trie.insert(filters[i], i);
+
+  for (auto &topic : topics) {
+    std::vector<size_t> ids;
+    trie.match(topic, ids);
+    std::sort(ids.begin(), ids.end());
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < filters.size(); i++) {
+      if (reference_match(topic, filters[i]))
+        expected.push_back(i);
+    }
+    if (ids != expected) {
+      printf("Mismatch for topic '%s'\n", topic.c_str());
+      return 1;
+    }
+  }
+
+  size_t linear_matches = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < iterations; n++) {
+    for (auto &topic : topics) {
+      for (auto &filter : filters)
+        linear_matches += linear_match(topic, filter);
+    }
+  }
+  auto mid = std::chrono::steady_clock::now();
+  size_t trie_matches = 0;
+  std::vector<size_t> ids;
+  for (int n = 0; n < iterations; n++) {
+    for (auto &topic : topics) {
+      ids.clear();
+      trie.match(topic, ids);
+      trie_matches += ids.size();
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double messages = double(iterations) * topics.size();
+  printf("%zu subscriptions, %zu topics\n", filters.size(), topics.size());
+  printf("linear %8.1f ns/message (%zu matches)\n",
+         std::chrono::duration<double, std::nano>(mid - start).count() / messages, linear_matches);
+  printf("trie   %8.1f ns/message (%zu matches)\n",
+         std::chrono::duration<double, std::nano>(end - mid).count() / messages, trie_matches);
+  return 0;
+}
@@ -0,0 +1,135 @@
+// Host test for the readiness monitoring of the BSD sockets implementation, checks that wait_for_readiness() sleeps
+// while the monitored sockets are idle, wakes up as soon as a connection or data arrives, and that ready() follows.
+//
+//   g++ -O2 -std=gnu++11 -pthread -include limits -I. -DUSE_SOCKET_IMPL_BSD_SOCKETS -DUSE_SOCKET_SELECT_SUPPORT
+//       -include netinet/in.h -include netinet/tcp.h -include arpa/inet.h -o /tmp/socket_readiness_test
+//       script/socket/readiness_test.cpp esphome/components/socket/bsd_sockets_impl.cpp
+//       esphome/components/socket/socket.cpp
+//   /tmp/socket_readiness_test
+#include "esphome/components/socket/socket.h"
+
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+using namespace esphome;
+
+static int failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      failures++; \
+    } \
+  } while (false)
+
+// Runs wait_for_readiness() and returns how long it took in milliseconds, or -1 if it didn't wait
+static long timed_wait(uint32_t timeout_ms) {
+  auto start = std::chrono::steady_clock::now();
+  if (!socket::wait_for_readiness(timeout_ms))
+    return -1;
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+static struct sockaddr_in loopback(uint16_t port) {
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  return addr;
+}
+
+static int connect_to(uint16_t port) {
+  int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr = loopback(port);
+  ::connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
+  return fd;
+}
+
+int main() {
+  // Nothing to wait for, the main loop has to sleep itself
+  CHECK(timed_wait(10) == -1);
+
+  // Sockets that aren't monitored are always ready
+  auto plain = socket::socket(AF_INET, SOCK_STREAM, 0);
+  CHECK(plain->ready());
+  CHECK(timed_wait(10) == -1);
+  plain->close();
+
+  auto listener = socket::socket_monitored(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr = loopback(0);
+  CHECK(listener->bind(reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0);
+  CHECK(listener->listen(4) == 0);
+  socklen_t len = sizeof(addr);
+  listener->getsockname(reinterpret_cast<struct sockaddr *>(&addr), &len);
+  uint16_t port = ntohs(addr.sin_port);
+
+  // A new socket is ready until the first select() found it idle
+  CHECK(listener->ready());
+  CHECK(timed_wait(0) >= 0);
+  CHECK(!listener->ready());
+
+  // An idle listener sleeps for the whole timeout
+  long waited = timed_wait(200);
+  CHECK(waited >= 190);
+  CHECK(!listener->ready());
+
+  // A connection wakes it up right away
+  int client = -1;
+  std::thread connector([&client, port]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    client = connect_to(port);
+  });
+  waited = timed_wait(2000);
+  connector.join();
+  printf("woke up after %ld ms for a connection\n", waited);
+  CHECK(waited >= 0 && waited < 1000);
+  CHECK(listener->ready());
+
+  // Accepted sockets inherit the monitoring
+  len = sizeof(addr);
+  auto conn = listener->accept(reinterpret_cast<struct sockaddr *>(&addr), &len);
+  CHECK(conn != nullptr);
+  conn->setblocking(false);
+  CHECK(conn->ready());
+  CHECK(timed_wait(0) >= 0);
+  CHECK(!listener->ready());
+  CHECK(!conn->ready());
+
+  // Data wakes it up and the socket is ready until it has been read
+  std::thread writer([client]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(::write(client, "ping", 4) == 4);
+  });
+  waited = timed_wait(2000);
+  writer.join();
+  printf("woke up after %ld ms for data\n", waited);
+  CHECK(waited >= 0 && waited < 1000);
+  CHECK(conn->ready());
+  CHECK(!listener->ready());
+  char buf[16];
+  CHECK(conn->read(buf, sizeof(buf)) == 4);
+  CHECK(timed_wait(0) >= 0);
+  CHECK(!conn->ready());
+
+  // So does the peer closing the connection
+  ::close(client);
+  CHECK(timed_wait(1000) >= 0);
+  CHECK(conn->ready());
+  CHECK(conn->read(buf, sizeof(buf)) == 0);
+
+  // Closed sockets aren't monitored anymore
+  conn->close();
+  listener->close();
+  CHECK(timed_wait(10) == -1);
+
+  if (failures != 0) {
+    printf("%d checks failed\n", failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
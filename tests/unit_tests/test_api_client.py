@@ -0,0 +1,128 @@
+import struct
+
+import pytest
+
+from esphome.components.api import client
+
+
+def zigzag(value):
+    return client._encode_varint((value << 1) ^ (value >> 63))
+
+
+def pack_string(value):
+    data = value.encode("utf8")
+    return client._encode_varint(len(data)) + data
+
+
+def pack_double(value):
+    return struct.pack("<d", value)
+
+
+@pytest.mark.parametrize(
+    "fmt, args, expected",
+    (
+        ("no arguments", b"", "no arguments"),
+        ("%d%%", zigzag(-42), "-42%"),
+        ("%i %d", zigzag(7) + zigzag(-1), "7 -1"),
+        ("%u", client._encode_varint(4294967295), "4294967295"),
+        ("%02X:%02X", client._encode_varint(10) + client._encode_varint(255), "0A:FF"),
+        ("%#x %o", client._encode_varint(255) + client._encode_varint(8), "0xff 10"),
+        ("%5d|%-5d|", zigzag(12) + zigzag(12), "   12|12   |"),
+        ("%*d", zigzag(4) + zigzag(3), "   3"),
+        ("%.*f", zigzag(2) + pack_double(3.14159), "3.14"),
+        ("%.1f %s", pack_double(21.25) + pack_string("°C"), "21.2 °C"),
+        ("%lu %lld %zu", client._encode_varint(1) + zigzag(-2) + client._encode_varint(3), "1 -2 3"),
+        ("%c", zigzag(ord("A")), "A"),
+        ("%p", client._encode_varint(0x3FFB0000), "0x3ffb0000"),
+        ("'%s'", pack_string(""), "''"),
+    ),
+)
+def test_format_packed_args(fmt, args, expected):
+    actual = client.format_packed_args(fmt, args)
+
+    assert actual == expected
+
+
+@pytest.mark.parametrize(
+    "fmt, args",
+    (
+        ("%d", b""),
+        ("%f", b"\x00\x00"),
+        ("%d %d", zigzag(1)),
+    ),
+)
+def test_format_packed_args__missing_arguments(fmt, args):
+    actual = client.format_packed_args(fmt, args)
+
+    assert actual == fmt + " <invalid log arguments>"
+
+
+def string_response(id_, value):
+    msg = client.SubscribeLogsStringResponse()
+    msg.ParseFromString(
+        client._encode_varint(1 << 3)
+        + client._encode_varint(id_)
+        + client._encode_varint(2 << 3 | 2)
+        + pack_string(value)
+    )
+    return msg
+
+
+def binary_response(level, tag_id, format_id, line, args):
+    msg = client.SubscribeLogsBinaryResponse()
+    msg.ParseFromString(
+        client._encode_varint(1 << 3)
+        + client._encode_varint(level)
+        + client._encode_varint(2 << 3)
+        + client._encode_varint(tag_id)
+        + client._encode_varint(3 << 3)
+        + client._encode_varint(format_id)
+        + client._encode_varint(4 << 3)
+        + client._encode_varint(line)
+        + client._encode_varint(5 << 3)
+        + client._encode_varint(123456)
+        + client._encode_varint(6 << 3 | 2)
+        + client._encode_varint(len(args))
+        + args
+    )
+    return msg
+
+
+def test_binary_log_decoder__format():
+    decoder = client.BinaryLogDecoder()
+    decoder.on_string(string_response(1, "sensor"))
+    decoder.on_string(string_response(2, "'%s': Sending state %.2f %s\n"))
+
+    args = pack_string("Temperature") + pack_double(21.5) + pack_string("°C")
+    actual = decoder.format(binary_response(5, 1, 2, 7, args))
+
+    assert actual == "\033[0;36m[D][sensor:007]: 'Temperature': Sending state 21.50 °C\033[0m"
+
+
+def test_binary_log_decoder__unknown_strings():
+    decoder = client.BinaryLogDecoder()
+
+    actual = decoder.format(binary_response(1, 1, 2, 42, b""))
+
+    assert actual == "\033[1;31m[E][?:042]: <unknown format 2>\033[0m"
+
+
+def test_binary_log_decoder__level_out_of_range():
+    decoder = client.BinaryLogDecoder()
+    decoder.on_string(string_response(1, "tag"))
+    decoder.on_string(string_response(2, "message"))
+
+    actual = decoder.format(binary_response(9, 1, 2, 1, b""))
+
+    assert actual == "\033[0;38m[VV][tag:001]: message\033[0m"
+
+
+def test_binary_log_decoder__reset():
+    decoder = client.BinaryLogDecoder()
+    decoder.on_string(string_response(1, "tag"))
+    decoder.on_string(string_response(2, "message"))
+
+    decoder.reset()
+    actual = decoder.format(binary_response(3, 1, 2, 1, b""))
+
+    assert actual == "\033[0;32m[I][?:001]: <unknown format 2>\033[0m"
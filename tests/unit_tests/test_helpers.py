@@ -81,6 +81,41 @@ def test_cpp_string_escape(string, expected):
     assert actual == expected
 
 
+@pytest.mark.parametrize(
+    "name, expected",
+    (
+        ("Living Room Temperature", "living_room_temperature"),
+        ("Wi-Fi Signal (dB)", "wi-fi_signal_db"),
+        ("Température", "temprature"),
+        ("", ""),
+    ),
+)
+def test_snake_case_sanitize(name, expected):
+    actual = helpers.sanitize(helpers.snake_case(name))
+
+    assert actual == expected
+
+
+# The expected values are the results of fnv1_hash() in esphome/core/helpers.cpp, the
+# codegen passes these hashes to the C++ code, which computes them for runtime strings.
+@pytest.mark.parametrize(
+    "value, expected",
+    (
+        ("", 2166136261),
+        ("a", 0x050C5D7E),
+        ("living_room", 0xC7FCCA2C),
+        ("sensor", 0x75E61B1B),
+        ("sensor.dallas", 0x19087C5E),
+        ("api.connection", 0x4910A02F),
+        ("mqtt.component", 0xD624D6F4),
+    ),
+)
+def test_fnv1_hash(value, expected):
+    actual = helpers.fnv1_hash(value)
+
+    assert actual == expected
+
+
 @pytest.mark.parametrize(
     "host",
     (